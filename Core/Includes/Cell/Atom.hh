@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Optional.hh>
+#include <Cell/StringView.hh>
+#include <Cell/Collection/Hash.hh>
+
+namespace Cell {
+
+// Handle for interned text, e.g. an asset path, a JSON key or an action name.
+//
+// Every distinct text is stored once, for the lifetime of the program, and identified by a 32-bit ID, so comparing atoms is an integer compare.
+// The hash of the text is computed once when it's interned, and can be computed at compile time for literals through ComputeHash.
+// Interning is thread safe. Text that's already interned is found without locking, as are the text and hash of an atom.
+class Atom {
+public:
+    // Creates the atom for empty text.
+    CELL_FUNCTION_TEMPLATE constexpr Atom() : id(0) { }
+
+    // Returns the atom for the given text, interning it if it's new.
+    CELL_NODISCARD CELL_FUNCTION static Atom Intern(const StringView text);
+
+    // Returns the atom for the given text, interning it if it's new. The hash has to be ComputeHash(text), e.g. computed at compile time.
+    CELL_NODISCARD CELL_FUNCTION static Atom Intern(const StringView text, const uint32_t hash);
+
+    // Returns the atom for the given text if it's been interned, without interning it otherwise.
+    CELL_NODISCARD CELL_FUNCTION static Optional<Atom> Find(const StringView text);
+
+    // Hashes the given text the same way atoms are. Usable at compile time.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE static constexpr uint32_t ComputeHash(const StringView text) {
+        return (uint32_t)Collection::HashBytes(text.ToRawPointer(), text.GetSize());
+    }
+
+    // Returns the interned text. It stays valid for the lifetime of the program.
+    CELL_NODISCARD CELL_FUNCTION StringView GetText() const;
+
+    // Returns the hash of the text, as computed by ComputeHash.
+    CELL_NODISCARD CELL_FUNCTION uint32_t GetHash() const;
+
+    // Returns the ID of the atom. IDs are handed out in the order texts get interned, starting at 1; the empty atom is 0.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr uint32_t GetId() const {
+        return this->id;
+    }
+
+    // Checks whether this is the atom for empty text.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool IsEmpty() const {
+        return this->id == 0;
+    }
+
+    // Comparison operator.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool operator == (const Atom other) const {
+        return this->id == other.id;
+    }
+
+    // Comparison operator.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool operator != (const Atom other) const {
+        return this->id != other.id;
+    }
+
+private:
+    CELL_FUNCTION_TEMPLATE constexpr explicit Atom(const uint32_t id) : id(id) { }
+
+    uint32_t id;
+};
+
+}
+
+namespace Cell::Collection {
+
+// Hash for atoms, which is the precomputed hash of their text.
+template <> struct Hash<Atom> {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE static uint64_t Compute(const Atom& value) {
+        return value.GetHash();
+    }
+};
+
+}
@@ -6,6 +6,9 @@
 #include <stddef.h> // IWYU pragma: export
 #include <stdint.h> // IWYU pragma: export
 
+// Declared here rather than through <new>, which is all the compiler needs to pass alignments of over-aligned types on to operator new.
+namespace std { enum class align_val_t : size_t; }
+
 namespace Cell {
 
 // Base class type for Cell.
@@ -16,6 +19,10 @@ public:
     CELL_FUNCTION static void* CELL_NONNULL operator new(size_t size);
     CELL_FUNCTION static void operator delete(void* CELL_NONNULL memory, size_t size);
 
+    // Used for types aligned more strictly than slab blocks are, e.g. ones with members on their own cache lines.
+    CELL_FUNCTION static void* CELL_NONNULL operator new(size_t size, std::align_val_t alignment);
+    CELL_FUNCTION static void operator delete(void* CELL_NONNULL memory, size_t size, std::align_val_t alignment);
+
 protected:
     constexpr Object() = default;
 };
@@ -8,7 +8,7 @@
 namespace Cell::Collection {
 
 // Shim template for a block of memory as an enumerable.
-template <typename T, size_t S> class Array : public IEnumerable<const T> {
+template <typename T, size_t S> class Array : public Object {
 public:
     // Creates a new array from the given block, and assumes its size.
     CELL_FUNCTION_TEMPLATE constexpr Array(T (* blockPtr)[S]) : block(*blockPtr) { }
@@ -17,41 +17,46 @@ public:
     CELL_FUNCTION_TEMPLATE constexpr ~Array() = default;
 
     // Returns the number of elements in the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
         return S;
     }
 
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
     // Returns the element at the index within the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) {
         CELL_ASSERT(index < S);
 
         return this->block[index];
     }
 
     // Returns the element at the index within the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const {
         CELL_ASSERT(index < S);
 
         return this->block[index];
     }
 
     // Returns the start address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() {
         return this->block;
     }
 
     // Returns the end address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() {
         return this->block + S;
     }
 
     // Returns the start address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const {
         return this->block;
     }
 
     // Returns the end address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const {
         return this->block + S;
     }
 
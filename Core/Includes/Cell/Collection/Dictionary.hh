@@ -11,7 +11,7 @@
 namespace Cell::Collection {
 
 // Key-value dictionary enumerable.
-template <typename K, typename V> class Dictionary : public IEnumerable<V> {
+template <typename K, typename V> class Dictionary : public Object {
 public:
     // Creates a dictionary with the given number of empty key-value pairs.
     // By default, it creates an entirely empty pair block.
@@ -98,10 +98,15 @@ public:
     }
 
     // Returns the number of stored pairs.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
         return this->count;
     }
 
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
     // Changes the number of stored pairs in the storage block.
     // In case this size is smaller, the dictionary is cut from its end.
     // If the size is bigger, empty pairs are added to the end.
@@ -156,7 +161,7 @@ public:
 
     // Gets the value at the given index.
     // Meant for the enumerator interface.
-    CELL_NODISCARD V& operator [] (const size_t index) override {
+    CELL_NODISCARD V& operator [] (const size_t index) {
         CELL_ASSERT(index < this->count);
 
         return this->pairBlock[index].value;
@@ -164,7 +169,7 @@ public:
 
     // Gets the value at the given index.
     // Meant for the enumerator interface.
-    CELL_NODISCARD const V& operator [] (const size_t index) const override {
+    CELL_NODISCARD const V& operator [] (const size_t index) const {
         CELL_ASSERT(index < this->count);
 
         return this->pairBlock[index].value;
@@ -172,24 +177,24 @@ public:
 
     // Begin operator for the enumerator interface.
     // Returns the address of the value in the first pair.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* begin() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* begin() {
         return &(this->pairBlock->value);
     }
 
     // Begin operator for the enumerator interface.
     // Returns the address of the value in the first pair.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* end() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* end() {
         return &((this->pairBlock + this->count)->value);
     }
 
     // Begin operator for constant foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V* begin() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V* begin() const {
         return &(this->pairBlock->value);
     }
 
     // End operator for the enumerator interface.
     // Returns the address of the value in the last pair.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V* end() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V* end() const {
         return &((this->pairBlock + this->count)->value);
     }
 
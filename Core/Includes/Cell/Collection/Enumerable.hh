@@ -8,7 +8,22 @@
 
 namespace Cell::Collection {
 
-// Enumerable interface for list like objects.
+// Requirements for list like collections, checked at compile time.
+// All collections fulfill it; code that accesses elements in hot loops should take Span or a template constrained by this instead of IEnumerable.
+template <typename C> concept Enumerable = requires (C& collection, const size_t index) {
+    collection.GetCount();
+    collection[index];
+    collection.begin();
+    collection.end();
+};
+
+// Requirements for enumerables that store elements of type T contiguously, so that begin() yields a plain pointer.
+template <typename C, typename T> concept ContiguousEnumerable = Enumerable<C> && requires (C& collection, T*& pointer) {
+    pointer = collection.begin();
+};
+
+// Enumerable interface for list like objects, for when the type of collection has to be picked at runtime.
+// Implementing it is optional; the collections in Cell don't, to spare them a virtual call on every access.
 template <typename T> class IEnumerable : public Object {
 public:
     // Retrieves the count of elements in this enumerable.
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/String.hh>
+
+namespace Cell::Collection {
+
+// Scrambles the bits of the given value, so that every input bit affects every output bit (MurmurHash3's finalizer).
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr uint64_t MixHash(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ull;
+    value ^= value >> 33;
+
+    return value;
+}
+
+// Hashes size bytes of data. Usable at compile time.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr uint64_t HashBytes(const char* data, const size_t size, const uint64_t seed = 0) {
+    uint64_t hash = seed ^ (size * 0x9e3779b97f4a7c15ull);
+
+    // words are assembled byte by byte to stay constexpr; compilers turn this into a single load
+    size_t offset = 0;
+    for (; offset + 8 <= size; offset += 8) {
+        uint64_t word = 0;
+        for (size_t i = 0; i < 8; i++) {
+            word |= (uint64_t)(uint8_t)data[offset + i] << (i * 8);
+        }
+
+        hash = (hash ^ MixHash(word)) * 0x9e3779b97f4a7c15ull;
+        hash = (hash << 27) | (hash >> 37);
+    }
+
+    if (offset < size) {
+        uint64_t word = 0;
+        for (size_t i = 0; offset + i < size; i++) {
+            word |= (uint64_t)(uint8_t)data[offset + i] << (i * 8);
+        }
+
+        hash ^= MixHash(word);
+    }
+
+    return MixHash(hash);
+}
+
+// Default hash for keys. Integers, enumerations and pointers are supported out of the box.
+// Other key types need a specialization, or a custom hash passed to the collection, providing a static Compute function.
+template <typename T> struct Hash {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE static constexpr uint64_t Compute(const T& value) {
+        return MixHash((uint64_t)value);
+    }
+};
+
+// Hash for strings, based on their contents.
+template <> struct Hash<String> {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE static uint64_t Compute(const String& value) {
+        const size_t size = value.GetSize();
+        if (size == 0) {
+            return HashBytes("", 0);
+        }
+
+        return HashBytes(value.ToRawPointer(), size);
+    }
+};
+
+// Hash for string views, based on their contents. Matches the hash of an equal string.
+template <> struct Hash<StringView> {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE static constexpr uint64_t Compute(const StringView& value) {
+        return HashBytes(value.ToRawPointer(), value.GetSize());
+    }
+};
+
+}
@@ -0,0 +1,450 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Optional.hh>
+#include <Cell/Collection/Enumerable.hh>
+#include <Cell/Collection/Hash.hh>
+#include <Cell/Collection/List.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Tracking.hh>
+#include <Cell/Utilities/Move.hh>
+
+namespace Cell::Collection {
+
+// Key-value hash table.
+//
+// Keys and values are stored densely, in insertion order until entries get removed, and enumerating the map yields its values.
+// Lookups go through a separate open addressing index using Robin Hood probing, which keeps probe sequences short
+//  and allows removing entries by shifting their successors back, without leaving tombstones behind.
+// Removing an entry moves the last entry into its place, changing its index.
+template <typename K, typename V, typename H = Hash<K>> class HashMap : public Object {
+public:
+    // Creates a hash map with room for the given number of entries.
+    CELL_FUNCTION_TEMPLATE explicit HashMap(const size_t capacity = 0) {
+        this->Reserve(capacity);
+    }
+
+    // Creates a hash map by copying the entries of another.
+    CELL_FUNCTION_TEMPLATE HashMap(const HashMap<K, V, H>& map) : keys(map.keys), values(map.values), hashes(map.hashes) {
+        this->CopySlots(map);
+    }
+
+    // Creates a hash map by taking over the storage of another, which is left empty.
+    CELL_FUNCTION_TEMPLATE HashMap(HashMap<K, V, H>&& map)
+        : keys(Utilities::Move(map.keys)), values(Utilities::Move(map.values)), hashes(Utilities::Move(map.hashes)),
+          slots(map.slots), slotCount(map.slotCount) {
+        map.slots = nullptr;
+        map.slotCount = 0;
+    }
+
+    // Destructs all entries and frees the map's memory.
+    CELL_FUNCTION_TEMPLATE ~HashMap() {
+        if (this->slots != nullptr) {
+            Memory::Free(this->slots);
+        }
+    }
+
+    // Sets the value for the given key, adding the key if it's not part of the map yet. Returns the stored value.
+    CELL_FUNCTION_TEMPLATE V& Set(const K& key, const V& value) {
+        const uint32_t hash = (uint32_t)H::Compute(key);
+
+        const size_t slot = this->FindSlot(key, hash);
+        if (slot != NoSlot) {
+            V& stored = this->values[this->slots[slot].index];
+            stored = value;
+            return stored;
+        }
+
+        this->keys.Append(key);
+        this->values.Append(value);
+        return this->InsertLast(hash);
+    }
+
+    // Sets the value for the given key by moving it in, adding the key if it's not part of the map yet. Returns the stored value.
+    CELL_FUNCTION_TEMPLATE V& Set(const K& key, V&& value) {
+        const uint32_t hash = (uint32_t)H::Compute(key);
+
+        const size_t slot = this->FindSlot(key, hash);
+        if (slot != NoSlot) {
+            V& stored = this->values[this->slots[slot].index];
+            stored = Utilities::Move(value);
+            return stored;
+        }
+
+        this->keys.Append(key);
+        this->values.Append(Utilities::Move(value));
+        return this->InsertLast(hash);
+    }
+
+    // Returns the value for the given key, adding a default constructed one if the key isn't part of the map yet.
+    CELL_FUNCTION_TEMPLATE V& GetOrAdd(const K& key) {
+        const uint32_t hash = (uint32_t)H::Compute(key);
+
+        const size_t slot = this->FindSlot(key, hash);
+        if (slot != NoSlot) {
+            return this->values[this->slots[slot].index];
+        }
+
+        this->keys.Append(key);
+        this->values.Emplace();
+        return this->InsertLast(hash);
+    }
+
+    // Checks whether the given key is part of the map, and returns the index of its entry if so.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Optional<size_t> Has(const K& key) const {
+        const size_t slot = this->FindSlot(key, (uint32_t)H::Compute(key));
+        if (slot == NoSlot) {
+            return { };
+        }
+
+        return (size_t)this->slots[slot].index;
+    }
+
+    // Returns a pointer to the value stored for the given key, or nullptr if the key isn't part of the map.
+    // The pointer is invalidated once entries are added or removed.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* CELL_NULLABLE Find(const K& key) {
+        const size_t slot = this->FindSlot(key, (uint32_t)H::Compute(key));
+        if (slot == NoSlot) {
+            return nullptr;
+        }
+
+        return this->values.GetPointer(this->slots[slot].index);
+    }
+
+    // Returns the value stored for the given key, which must be part of the map.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V& GetValue(const K& key) {
+        V* value = this->Find(key);
+        CELL_ASSERT(value != nullptr);
+
+        return *value;
+    }
+
+    // Returns the key of the entry at the given index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const K& GetKey(const size_t index) const {
+        return this->keys[index];
+    }
+
+    // Removes the given key and its value. Returns false if the key wasn't part of the map.
+    CELL_FUNCTION_TEMPLATE bool Remove(const K& key) {
+        const size_t slot = this->FindSlot(key, (uint32_t)H::Compute(key));
+        if (slot == NoSlot) {
+            return false;
+        }
+
+        const uint32_t index = this->slots[slot].index;
+        this->EraseSlot(slot);
+
+        // the last entry moves into the gap, so its slot has to follow it
+        const uint32_t last = (uint32_t)this->keys.GetCount() - 1;
+        if (index != last) {
+            this->slots[this->FindIndexSlot(last, this->hashes[last])].index = index;
+        }
+
+        this->keys.RemoveUnordered(index);
+        this->values.RemoveUnordered(index);
+        this->hashes.RemoveUnordered(index);
+
+        return true;
+    }
+
+    // Removes all entries, keeping the allocated memory around.
+    CELL_FUNCTION_TEMPLATE void Clear() {
+        this->keys.SetCount(0);
+        this->values.SetCount(0);
+        this->hashes.SetCount(0);
+
+        this->ClearSlots();
+    }
+
+    // Removes all entries and frees the map's memory.
+    CELL_FUNCTION_TEMPLATE void Reset() {
+        this->keys.Reset();
+        this->values.Reset();
+        this->hashes.Reset();
+
+        if (this->slots != nullptr) {
+            Memory::Free(this->slots);
+        }
+
+        this->slots = nullptr;
+        this->slotCount = 0;
+    }
+
+    // Makes sure the map can hold at least the given number of entries without growing.
+    CELL_FUNCTION_TEMPLATE void Reserve(const size_t capacity) {
+        if (capacity == 0) {
+            return;
+        }
+
+        this->keys.Reserve(capacity);
+        this->values.Reserve(capacity);
+        this->hashes.Reserve(capacity);
+
+        size_t slotCount = MinimumSlotCount;
+        while (capacity > GetMaximumLoad(slotCount)) {
+            slotCount *= 2;
+        }
+
+        if (slotCount > this->slotCount) {
+            this->Rehash(slotCount);
+        }
+    }
+
+    // Rebuilds the index with the given number of slots, which is rounded up to a power of two large enough to hold all entries.
+    // Passing 0 shrinks the index as far as possible.
+    CELL_FUNCTION_TEMPLATE void Rehash(const size_t slotCount) {
+        size_t count = MinimumSlotCount;
+        while (count < slotCount || this->keys.GetCount() > GetMaximumLoad(count)) {
+            count *= 2;
+        }
+
+        CELL_ASSERT(count <= 0x100000000ull);
+
+        if (this->slots != nullptr) {
+            Memory::Free(this->slots);
+        }
+
+        {
+            CELL_MEMORY_FALLBACK_TAG(Collection);
+            this->slots = Memory::AllocateUninitialized<Slot>(count);
+        }
+
+        this->slotCount = count;
+        this->ClearSlots();
+
+        // stored hashes spare calling the hash function again
+        for (size_t i = 0; i < this->hashes.GetCount(); i++) {
+            this->InsertSlot({ (uint32_t)i, this->hashes[i] });
+        }
+    }
+
+    // Returns the number of stored entries.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
+        return this->keys.GetCount();
+    }
+
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
+    // Returns the number of entries the map can store before its index has to grow.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCapacity() const {
+        return GetMaximumLoad(this->slotCount);
+    }
+
+    // Retrieves the value of the entry at the specified index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V& operator [] (const size_t index) {
+        return this->values[index];
+    }
+
+    // Retrieves the value of the entry at the specified index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V& operator [] (const size_t index) const {
+        return this->values[index];
+    }
+
+    // Overwrites the contents of this map with the given map.
+    CELL_FUNCTION_TEMPLATE HashMap<K, V, H>& operator = (const HashMap<K, V, H>& map) {
+        if (this == &map) {
+            return *this;
+        }
+
+        this->keys = map.keys;
+        this->values = map.values;
+        this->hashes = map.hashes;
+
+        if (this->slots != nullptr) {
+            Memory::Free(this->slots);
+        }
+
+        this->CopySlots(map);
+        return *this;
+    }
+
+    // Replaces the contents of this map by taking over the storage of the given map, which is left empty.
+    CELL_FUNCTION_TEMPLATE HashMap<K, V, H>& operator = (HashMap<K, V, H>&& map) {
+        if (this == &map) {
+            return *this;
+        }
+
+        this->keys = Utilities::Move(map.keys);
+        this->values = Utilities::Move(map.values);
+        this->hashes = Utilities::Move(map.hashes);
+
+        if (this->slots != nullptr) {
+            Memory::Free(this->slots);
+        }
+
+        this->slots = map.slots;
+        this->slotCount = map.slotCount;
+
+        map.slots = nullptr;
+        map.slotCount = 0;
+
+        return *this;
+    }
+
+    // Begin operator for foreach operations over the values.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* begin() {
+        return this->values.begin();
+    }
+
+    // End operator for foreach operations over the values.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE V* end() {
+        return this->values.end();
+    }
+
+    // Begin operator for constant foreach operations over the values.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V* begin() const {
+        return this->values.begin();
+    }
+
+    // End operator for constant foreach operations over the values.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const V* end() const {
+        return this->values.end();
+    }
+
+private:
+    // Index entry, pointing to a stored entry. The lower bits of the hash select the slot the entry would ideally be in.
+    struct Slot {
+        uint32_t index;
+        uint32_t hash;
+    };
+
+    static constexpr uint32_t EmptySlot = 0xffffffff;
+    static constexpr size_t NoSlot = (size_t)-1;
+    static constexpr size_t MinimumSlotCount = 8;
+
+    // Robin Hood probing stays fast up to high loads; the index is kept at most 7/8 full.
+    CELL_FUNCTION_TEMPLATE static constexpr size_t GetMaximumLoad(const size_t slotCount) {
+        return slotCount - slotCount / 8;
+    }
+
+    // Returns how far the slot at the given position is from where its entry would ideally be.
+    CELL_FUNCTION_TEMPLATE size_t GetDistance(const size_t position) const {
+        return (position - (this->slots[position].hash & (this->slotCount - 1))) & (this->slotCount - 1);
+    }
+
+    CELL_FUNCTION_TEMPLATE size_t FindSlot(const K& key, const uint32_t hash) const {
+        if (this->slotCount == 0) {
+            return NoSlot;
+        }
+
+        const size_t mask = this->slotCount - 1;
+
+        size_t position = hash & mask;
+        for (size_t distance = 0; ; distance++) {
+            const Slot& slot = this->slots[position];
+
+            // entries are ordered by distance, so ours would have displaced any that's closer to its ideal slot
+            if (slot.index == EmptySlot || this->GetDistance(position) < distance) {
+                return NoSlot;
+            }
+
+            if (slot.hash == hash && this->keys[slot.index] == key) {
+                return position;
+            }
+
+            position = (position + 1) & mask;
+        }
+    }
+
+    CELL_FUNCTION_TEMPLATE size_t FindIndexSlot(const uint32_t index, const uint32_t hash) const {
+        const size_t mask = this->slotCount - 1;
+
+        size_t position = hash & mask;
+        while (this->slots[position].index != index) {
+            position = (position + 1) & mask;
+        }
+
+        return position;
+    }
+
+    // Indexes the entry that was just appended to the dense storage, growing the index if needed.
+    CELL_FUNCTION_TEMPLATE V& InsertLast(const uint32_t hash) {
+        this->hashes.Append(hash);
+
+        const size_t index = this->keys.GetCount() - 1;
+        if (index + 1 > GetMaximumLoad(this->slotCount)) {
+            // rebuilding indexes the new entry as well
+            this->Rehash(this->slotCount * 2);
+        } else {
+            this->InsertSlot({ (uint32_t)index, hash });
+        }
+
+        return this->values[index];
+    }
+
+    CELL_FUNCTION_TEMPLATE void InsertSlot(Slot inserted) {
+        const size_t mask = this->slotCount - 1;
+
+        size_t position = inserted.hash & mask;
+        size_t distance = 0;
+
+        while (true) {
+            Slot& slot = this->slots[position];
+            if (slot.index == EmptySlot) {
+                slot = inserted;
+                return;
+            }
+
+            // take the place of entries closer to their ideal slot, and keep going with them instead
+            const size_t existing = this->GetDistance(position);
+            if (existing < distance) {
+                const Slot displaced = slot;
+                slot = inserted;
+
+                inserted = displaced;
+                distance = existing;
+            }
+
+            position = (position + 1) & mask;
+            distance++;
+        }
+    }
+
+    // Empties the given slot, shifting back the following entries that aren't in their ideal slot.
+    CELL_FUNCTION_TEMPLATE void EraseSlot(size_t position) {
+        const size_t mask = this->slotCount - 1;
+
+        size_t next = (position + 1) & mask;
+        while (this->slots[next].index != EmptySlot && this->GetDistance(next) > 0) {
+            this->slots[position] = this->slots[next];
+
+            position = next;
+            next = (next + 1) & mask;
+        }
+
+        this->slots[position].index = EmptySlot;
+    }
+
+    CELL_FUNCTION_TEMPLATE void ClearSlots() {
+        for (size_t i = 0; i < this->slotCount; i++) {
+            this->slots[i].index = EmptySlot;
+        }
+    }
+
+    CELL_FUNCTION_TEMPLATE void CopySlots(const HashMap<K, V, H>& map) {
+        this->slots = nullptr;
+        this->slotCount = map.slotCount;
+
+        if (map.slots == nullptr) {
+            return;
+        }
+
+        CELL_MEMORY_FALLBACK_TAG(Collection);
+        this->slots = Memory::AllocateUninitialized<Slot>(this->slotCount);
+        Memory::Copy<Slot>(this->slots, map.slots, this->slotCount);
+    }
+
+    List<K> keys;
+    List<V> values;
+    List<uint32_t> hashes;
+
+    Slot* slots = nullptr;
+    size_t slotCount = 0;
+};
+
+}
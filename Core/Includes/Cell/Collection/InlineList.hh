@@ -0,0 +1,339 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/Enumerable.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Construct.hh>
+#include <Cell/Memory/Tracking.hh>
+#include <Cell/Memory/UnownedBlock.hh>
+#include <Cell/Utilities/Concepts.hh>
+#include <Cell/Utilities/Move.hh>
+
+// Yes, I allow this
+#include <initializer_list>
+
+namespace Cell::Collection {
+
+// List storing up to N elements inside of itself, only moving them to the heap once it grows past that.
+//
+// Meant for lists that are usually small, where a heap allocation would cost more than the list's contents.
+// Unlike List, moving an inline list moves its elements one by one, as long as they're stored inline.
+template <typename T, size_t N> class InlineList : public Object {
+    CELL_STATIC_ASSERT(N > 0);
+
+public:
+    // Creates a list of empty T elements with the given expected number of elements.
+    CELL_FUNCTION_TEMPLATE explicit InlineList(const size_t count = 0) {
+        this->SetCount(count);
+    }
+
+    // Creates a list with all given elements.
+    CELL_FUNCTION_TEMPLATE InlineList(const std::initializer_list<T> list) {
+        this->CopyFrom(list.begin(), list.size());
+    }
+
+    // Creates a list by copying the entries in the given list.
+    CELL_FUNCTION_TEMPLATE InlineList(const InlineList<T, N>& list) {
+        this->CopyFrom(list.data, list.count);
+    }
+
+    // Creates a list by taking over the entries of the given list, which is left empty.
+    CELL_FUNCTION_TEMPLATE InlineList(InlineList<T, N>&& list) {
+        this->MoveFrom(list);
+    }
+
+    // Destructs the stored elements and frees the list's heap memory, if any.
+    CELL_FUNCTION_TEMPLATE ~InlineList() {
+        this->Reset();
+    }
+
+    // Destructs this list by deleting every object stored and freeing its heap memory, if any.
+    CELL_FUNCTION_TEMPLATE ~InlineList() requires Utilities::IsDeletable<T> {
+        for (size_t i = 0; i < this->count; i++) {
+            delete this->data[i];
+        }
+
+        this->Reset();
+    }
+
+    // Appends an element to the end of the list.
+    // Pointers to elements are invalidated once the list grows past its capacity.
+    CELL_FUNCTION_TEMPLATE void Append(const T& data) {
+        // the element might be part of this list, so its index has to be kept across growing
+        const uintptr_t address = (uintptr_t)&data;
+        if (this->count == this->capacity && address >= (uintptr_t)this->begin() && address < (uintptr_t)this->end()) {
+            const size_t index = &data - this->data;
+
+            this->Grow(this->count + 1);
+            Memory::Construct<T>(this->data + this->count++, this->data[index]);
+            return;
+        }
+
+        this->Grow(this->count + 1);
+        Memory::Construct<T>(this->data + this->count++, data);
+    }
+
+    // Appends an element to the end of the list, moving it in.
+    CELL_FUNCTION_TEMPLATE void Append(T&& data) {
+        this->Grow(this->count + 1);
+        Memory::Construct<T>(this->data + this->count++, Utilities::Move(data));
+    }
+
+    // Constructs a new element at the end of the list from the given arguments, and returns it.
+    // The arguments must not refer to elements of this list, as growing might move them.
+    template <typename... A> CELL_FUNCTION_TEMPLATE T& Emplace(A&&... arguments) {
+        this->Grow(this->count + 1);
+        return *Memory::Construct<T>(this->data + this->count++, Utilities::Forward<A>(arguments)...);
+    }
+
+    // Removes the list entry at the given index, moving all following entries down by one.
+    CELL_FUNCTION_TEMPLATE void Remove(const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        Memory::Destruct<T>(this->data + index);
+        Memory::Relocate<T>(this->data + index, this->data + index + 1, this->count - index - 1);
+
+        this->count--;
+    }
+
+    // Removes the list entry at the given index by moving the last entry into its place.
+    // This doesn't preserve the order of entries, but takes constant time.
+    CELL_FUNCTION_TEMPLATE void RemoveUnordered(const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        Memory::Destruct<T>(this->data + index);
+
+        this->count--;
+        if (index != this->count) {
+            Memory::Relocate<T>(this->data + index, this->data + this->count, 1);
+        }
+    }
+
+    // Removes the first entry matching the given data. Returns false if none was found.
+    CELL_FUNCTION_TEMPLATE bool Remove(const T& data) {
+        for (size_t i = 0; i < this->count; i++) {
+            if (this->data[i] == data) {
+                Remove(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Removes all entries, and returns to inline storage.
+    CELL_FUNCTION_TEMPLATE void Reset() {
+        for (size_t i = 0; i < this->count; i++) {
+            Memory::Destruct<T>(this->data + i);
+        }
+
+        if (!this->IsInline()) {
+            Memory::Free(this->data);
+        }
+
+        this->data = (T*)this->storage;
+        this->count = 0;
+        this->capacity = N;
+    }
+
+    // Returns the number of stored entries.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
+        return this->count;
+    }
+
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
+    // Returns the number of entries the list can store before it has to grow.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCapacity() const {
+        return this->capacity;
+    }
+
+    // Checks whether the entries are still stored inside of the list itself.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsInline() const {
+        return this->data == (const T*)this->storage;
+    }
+
+    // Changes the number of stored entries in this list.
+    // If the count is smaller than the currently stored number of entries, it cuts away the remaining elements.
+    // If the count is larger, empty entries are added to the end.
+    CELL_FUNCTION_TEMPLATE void SetCount(const size_t count) {
+        if (count > this->capacity) {
+            this->Resize(count);
+        }
+
+        for (size_t i = count; i < this->count; i++) {
+            Memory::Destruct<T>(this->data + i);
+        }
+
+        if (count > this->count) {
+            if constexpr (Utilities::IsTriviallyCopyable<T>) {
+                Memory::Clear<T>(this->data + this->count, count - this->count);
+            } else {
+                for (size_t i = this->count; i < count; i++) {
+                    Memory::Construct<T>(this->data + i);
+                }
+            }
+        }
+
+        this->count = count;
+    }
+
+    // Makes sure the list can hold at least the given number of entries without growing.
+    CELL_FUNCTION_TEMPLATE void Reserve(const size_t capacity) {
+        if (capacity > this->capacity) {
+            this->Resize(capacity);
+        }
+    }
+
+    // Retrieves a pointer to a given element.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* GetPointer(const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        return this->data + index;
+    }
+
+    // Retrieves the entry at the specified index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        return this->data[index];
+    }
+
+    // Retrieves the entry at the specified index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const {
+        CELL_ASSERT(index < this->count);
+
+        return this->data[index];
+    }
+
+    // Returns this list as a block.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Memory::UnownedBlock<T> AsBlock() {
+        return Memory::UnownedBlock<T> { this->data, this->count };
+    }
+
+    // Returns the raw data pointer for the list. It's advised to use AsBlock() instead.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* AsRaw() {
+        return this->data;
+    }
+
+    // Overwrites the contents of this list with the given list.
+    CELL_FUNCTION_TEMPLATE InlineList<T, N>& operator = (const InlineList<T, N>& list) {
+        if (this == &list) {
+            return *this;
+        }
+
+        this->Reset();
+        this->CopyFrom(list.data, list.count);
+
+        return *this;
+    }
+
+    // Replaces the contents of this list by taking over the entries of the given list, which is left empty.
+    CELL_FUNCTION_TEMPLATE InlineList<T, N>& operator = (InlineList<T, N>&& list) {
+        if (this == &list) {
+            return *this;
+        }
+
+        this->Reset();
+        this->MoveFrom(list);
+
+        return *this;
+    }
+
+    // Begin operator for foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() {
+        return this->data;
+    }
+
+    // End operator for foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() {
+        return this->data + this->count;
+    }
+
+    // Begin operator for constant foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const {
+        return this->data;
+    }
+
+    // End operator for constant foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const {
+        return this->data + this->count;
+    }
+
+private:
+    // Grows the storage geometrically to fit at least the given number of entries.
+    CELL_FUNCTION_TEMPLATE void Grow(const size_t count) {
+        if (count <= this->capacity) {
+            return;
+        }
+
+        const size_t capacity = this->capacity * 2;
+        this->Resize(capacity < count ? count : capacity);
+    }
+
+    // Moves the stored entries to a heap block with exactly the given capacity. Storage never moves back inline.
+    CELL_FUNCTION_TEMPLATE void Resize(const size_t capacity) {
+        CELL_ASSERT(capacity > N && capacity >= this->count);
+
+        T* block = nullptr;
+        {
+            CELL_MEMORY_FALLBACK_TAG(Collection);
+            block = Memory::AllocateUninitialized<T>(capacity);
+        }
+
+        Memory::Relocate<T>(block, this->data, this->count);
+
+        if (!this->IsInline()) {
+            Memory::Free(this->data);
+        }
+
+        this->data = block;
+        this->capacity = capacity;
+    }
+
+    // Copies count entries into this list, which has to be empty.
+    CELL_FUNCTION_TEMPLATE void CopyFrom(const T* source, const size_t count) {
+        this->Reserve(count);
+
+        if constexpr (Utilities::IsTriviallyCopyable<T>) {
+            if (count > 0) {
+                Memory::Copy<T>(this->data, source, count);
+            }
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                Memory::Construct<T>(this->data + i, source[i]);
+            }
+        }
+
+        this->count = count;
+    }
+
+    // Takes over the entries of the given list, this list has to be empty.
+    CELL_FUNCTION_TEMPLATE void MoveFrom(InlineList<T, N>& list) {
+        if (list.IsInline()) {
+            Memory::Relocate<T>(this->data, list.data, list.count);
+        } else {
+            this->data = list.data;
+            this->capacity = list.capacity;
+
+            list.data = (T*)list.storage;
+            list.capacity = N;
+        }
+
+        this->count = list.count;
+        list.count = 0;
+    }
+
+    alignas(T) uint8_t storage[sizeof(T) * N];
+
+    T* data = (T*)this->storage;
+    size_t count = 0;
+    size_t capacity = N;
+};
+
+}
@@ -5,8 +5,12 @@
 
 #include <Cell/Collection/Enumerable.hh>
 #include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Arena.hh>
+#include <Cell/Memory/Construct.hh>
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/Memory/UnownedBlock.hh>
 #include <Cell/Utilities/Concepts.hh>
+#include <Cell/Utilities/Move.hh>
 
 // Yes, I allow this
 #include <initializer_list>
@@ -15,44 +19,49 @@ namespace Cell::Collection {
 
 template <typename T> class List;
 
-template <typename T> class ListView : public IEnumerable<const T> {
+template <typename T> class ListView : public Object {
 friend List<T>;
 
 public:
     CELL_FUNCTION_TEMPLATE ~ListView() = default;
 
     // Retrieves the count of elements in this enumerable.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
         return this->size;
     }
 
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
     // Retrieves the element at the given index.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) {
         return this->block[index];
     }
 
     // Retrieves the element at the given index.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const {
         return this->block[index];
     }
 
     // Begin operator for foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() {
         return this->block;
     }
 
     // End operator for foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() {
         return this->block + this->size;
     }
 
     // Begin operator for constant foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const {
         return this->block;
     }
 
     // End operator for constant foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const {
         return this->block + this->size;
     }
 
@@ -64,100 +73,135 @@ private:
 };
 
 // Generic list implementation.
-template <typename T> class List : public IEnumerable<T> {
+//
+// Storage grows geometrically, so the list usually holds more memory than its count of elements requires.
+// Elements that aren't trivially copyable are properly constructed, moved and destructed.
+template <typename T> class List : public Object {
 public:
     // Creates a list of empty T elements with the given expected number of elements.
-    CELL_FUNCTION_TEMPLATE explicit List(const size_t count = 0) : data(nullptr), count(count) {
-        if (this->count > 0) {
-            this->data = Memory::Allocate<T>(this->count);
-        }
+    CELL_FUNCTION_TEMPLATE explicit List(const size_t count = 0) {
+        this->SetCount(count);
     }
 
-    // Creates a list with an initial element.
-    CELL_FUNCTION_TEMPLATE explicit List(const T& initial) : count(1) {
-        this->data = Memory::Allocate<T>();
+    // Creates a list backed by the given arena, with the given expected number of empty T elements.
+    // The list's storage is released together with the arena; the arena must outlive the list.
+    CELL_FUNCTION_TEMPLATE explicit List(Memory::Arena& arena, const size_t count = 0) : arena(&arena) {
+        this->SetCount(count);
+    }
 
-        Memory::Copy<T>(&this->data[0], &initial);
+    // Creates a list with an initial element.
+    CELL_FUNCTION_TEMPLATE explicit List(const T& initial) {
+        this->Append(initial);
     }
 
     // Creates a list with the given initial element setting every element in the list, with the list containing count entries.
-    CELL_FUNCTION_TEMPLATE explicit List(const T& initial, const size_t count) : count(count) {
+    CELL_FUNCTION_TEMPLATE explicit List(const T& initial, const size_t count) {
         CELL_ASSERT(count > 1);
 
-        this->data = Memory::Allocate<T>(this->count);
-        for (size_t i = 0; i < this->count; i++) {
-            Memory::Copy<T>(&this->data[i], &initial);
+        this->Reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            Memory::Construct<T>(this->data + i, initial);
         }
+
+        this->count = count;
     }
 
     // Creates a list with all given elements.
-    CELL_FUNCTION_TEMPLATE List(const std::initializer_list<T> list) : count(list.size()) {
-        this->data = Memory::Allocate<T>(this->count);
-        Memory::Copy<T>(this->data, list.begin(), this->count);
+    CELL_FUNCTION_TEMPLATE List(const std::initializer_list<T> list) {
+        this->CopyFrom(list.begin(), list.size());
+    }
+
+    // Creates a list backed by the given arena, with all given elements.
+    CELL_FUNCTION_TEMPLATE List(Memory::Arena& arena, const std::initializer_list<T> list) : arena(&arena) {
+        this->CopyFrom(list.begin(), list.size());
     }
 
     // Creates a list by copying the entries in the given list.
-    CELL_FUNCTION_TEMPLATE List(const List<T>& list) : data(nullptr), count(0) {
-        if (list.count == 0) {
-            return;
-        }
+    // The copy always uses regular heap memory, as it might outlive the arena of the original.
+    CELL_FUNCTION_TEMPLATE List(const List<T>& list) {
+        this->CopyFrom(list.data, list.count);
+    }
 
-        this->count = list.count;
-        this->data = Memory::Allocate<T>(this->count);
-        Memory::Copy<T>(this->data, list.data, this->count);
+    // Creates a list by taking over the storage of the given list, which is left empty.
+    CELL_FUNCTION_TEMPLATE List(List<T>&& list) : data(list.data), count(list.count), capacity(list.capacity), arena(list.arena) {
+        list.data = nullptr;
+        list.count = 0;
+        list.capacity = 0;
     }
 
     // Destructs this list's memory.
     CELL_FUNCTION_TEMPLATE ~List() {
-        if (this->data == nullptr) {
-            return;
-        }
-
-        Memory::Free(this->data);
+        this->Reset();
     }
 
     // Destructs this list by deleting every object stored and freeing its memory.
     CELL_FUNCTION_TEMPLATE ~List() requires Utilities::IsDeletable<T> {
-        if (this->data == nullptr) {
-            return;
-        }
-
         for (size_t i = 0; i < this->count; i++) {
             delete this->data[i];
         }
 
-        Memory::Free(this->data);
+        this->Reset();
     }
 
     // Appends an element to the end of the list.
     //
-    // Note that appending past the preallocated entry block will cause the list
-    //  to automatically reallocate a larger list.
+    // Note that appending past the capacity of the list will cause it to reallocate a larger storage block.
     // this can move the list and its elements to a different memory location,
     //  invalidating pointers.
-    CELL_FUNCTION_TEMPLATE void Append(const T data) {
-        if (this->count == 0) {
-            this->data = Memory::Allocate<T>();
-        } else {
-            Memory::Reallocate<T>(this->data, this->count + 1);
+    CELL_FUNCTION_TEMPLATE void Append(const T& data) {
+        // the element might be part of this list, so its index has to be kept across growing
+        const uintptr_t address = (uintptr_t)&data;
+        if (this->count == this->capacity && address >= (uintptr_t)this->begin() && address < (uintptr_t)this->end()) {
+            const size_t index = &data - this->data;
+
+            this->Grow(this->count + 1);
+            Memory::Construct<T>(this->data + this->count++, this->data[index]);
+            return;
         }
 
-        this->data[this->count++] = data;
+        this->Grow(this->count + 1);
+        Memory::Construct<T>(this->data + this->count++, data);
+    }
+
+    // Appends an element to the end of the list, moving it in.
+    CELL_FUNCTION_TEMPLATE void Append(T&& data) {
+        this->Grow(this->count + 1);
+        Memory::Construct<T>(this->data + this->count++, Utilities::Move(data));
+    }
+
+    // Constructs a new element at the end of the list from the given arguments, and returns it.
+    // The arguments must not refer to elements of this list, as growing might move them.
+    template <typename... A> CELL_FUNCTION_TEMPLATE T& Emplace(A&&... arguments) {
+        this->Grow(this->count + 1);
+        return *Memory::Construct<T>(this->data + this->count++, Utilities::Forward<A>(arguments)...);
     }
 
-    // Removes the list entry at the given index.
+    // Removes the list entry at the given index, moving all following entries down by one.
+    // The storage block is kept, use ShrinkToFit to release unused memory.
     CELL_FUNCTION_TEMPLATE void Remove(const size_t index) {
         CELL_ASSERT(index < this->count);
 
-        if (index < this->count - 1) {
-            Memory::Copy<T>(this->data + index, this->data + index + 1, this->count - index);
-        }
+        Memory::Destruct<T>(this->data + index);
+        Memory::Relocate<T>(this->data + index, this->data + index + 1, this->count - index - 1);
 
-        Memory::Reallocate<T>(this->data, --this->count);
+        this->count--;
+    }
+
+    // Removes the list entry at the given index by moving the last entry into its place.
+    // This doesn't preserve the order of entries, but takes constant time.
+    CELL_FUNCTION_TEMPLATE void RemoveUnordered(const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        Memory::Destruct<T>(this->data + index);
+
+        this->count--;
+        if (index != this->count) {
+            Memory::Relocate<T>(this->data + index, this->data + this->count, 1);
+        }
     }
 
     // Removes the first entry matching the given data. Returns false if none was found.
-    CELL_FUNCTION_TEMPLATE bool Remove(const T data) {
+    CELL_FUNCTION_TEMPLATE bool Remove(const T& data) {
         CELL_ASSERT(this->count > 0);
 
         for (size_t i = 0; i < this->count; i++) {
@@ -172,34 +216,80 @@ public:
 
     // Resets the entire list by emptying its storage.
     CELL_FUNCTION_TEMPLATE void Reset() {
+        for (size_t i = 0; i < this->count; i++) {
+            Memory::Destruct<T>(this->data + i);
+        }
+
         if (this->data != nullptr) {
-            Memory::Free(this->data);
+            this->FreeBlock();
         }
 
         this->count = 0;
+        this->capacity = 0;
         this->data = nullptr;
     }
 
     // Returns the number of stored entries.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
         return this->count;
     }
 
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
+    // Returns the number of entries the list can store before it has to grow.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCapacity() const {
+        return this->capacity;
+    }
+
     // Changes the number of stored entries in this list.
     // If the count is smaller than the currently stored number of entries, it cuts away the remaining elements.
     // If the count is larger, empty entries are added to the end.
     CELL_FUNCTION_TEMPLATE void SetCount(const size_t count) {
-        CELL_ASSERT(count > 0);
+        if (count > this->capacity) {
+            this->Resize(count);
+        }
 
-        if (this->count == 0) {
-            this->data = Memory::Allocate<T>(count);
-        } else {
-            Memory::Reallocate<T>(this->data, count);
+        for (size_t i = count; i < this->count; i++) {
+            Memory::Destruct<T>(this->data + i);
+        }
+
+        if (count > this->count) {
+            if constexpr (Utilities::IsTriviallyCopyable<T>) {
+                Memory::Clear<T>(this->data + this->count, count - this->count);
+            } else {
+                for (size_t i = this->count; i < count; i++) {
+                    Memory::Construct<T>(this->data + i);
+                }
+            }
         }
 
         this->count = count;
     }
 
+    // Makes sure the list can hold at least the given number of entries without growing.
+    CELL_FUNCTION_TEMPLATE void Reserve(const size_t capacity) {
+        if (capacity > this->capacity) {
+            this->Resize(capacity);
+        }
+    }
+
+    // Shrinks the storage block to the number of stored entries.
+    CELL_FUNCTION_TEMPLATE void ShrinkToFit() {
+        if (this->count == this->capacity) {
+            return;
+        }
+
+        if (this->count == 0) {
+            this->Reset();
+            return;
+        }
+
+        this->Resize(this->count);
+    }
+
     // Retrieves a pointer to a given element.
     CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* GetPointer(const size_t index) {
         CELL_ASSERT(index < this->count);
@@ -208,14 +298,14 @@ public:
     }
 
     // Retrieves the entry at the specified index.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) {
         CELL_ASSERT(index < this->count);
 
         return this->data[index];
     }
 
     // Retrieves the entry at the specified index.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const {
         CELL_ASSERT(index < this->count);
 
         return this->data[index];
@@ -233,41 +323,53 @@ public:
 
     // Overwrites the contents of this list with the given list.
     CELL_FUNCTION_TEMPLATE List<T>& operator = (const List<T>& list) {
-        if (this->data == list.data) {
+        if (this == &list) {
             return *this;
         }
 
-        if (this->count > 0) {
-            Memory::Free(this->data);
-            this->data = nullptr;
+        this->Reset();
+        this->CopyFrom(list.data, list.count);
+
+        return *this;
+    }
+
+    // Replaces the contents of this list by taking over the storage of the given list, which is left empty.
+    CELL_FUNCTION_TEMPLATE List<T>& operator = (List<T>&& list) {
+        if (this == &list) {
+            return *this;
         }
 
+        this->Reset();
+
+        this->data = list.data;
         this->count = list.count;
-        if (this->count > 0) {
-            this->data = Memory::Allocate<T>(this->count);
-            Memory::Copy<T>(this->data, list.data, this->count);
-        }
+        this->capacity = list.capacity;
+        this->arena = list.arena;
+
+        list.data = nullptr;
+        list.count = 0;
+        list.capacity = 0;
 
         return *this;
     }
 
     // begin operator for loops.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() {
         return this->data;
     }
 
     // end operator for loops.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() {
         return this->data + this->count;
     }
 
     // Begin operator for constant foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const {
         return this->data;
     }
 
     // End operator for constant foreach operations.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const {
         return this->data + this->count;
     }
 
@@ -278,9 +380,95 @@ public:
     }
 
 private:
-    T* data;
-    size_t count;
+    // Smallest capacity allocated once the list holds anything.
+    static constexpr size_t MinimumCapacity = 4;
+
+    // Grows the storage geometrically to fit at least the given number of entries.
+    CELL_FUNCTION_TEMPLATE void Grow(const size_t count) {
+        if (count <= this->capacity) {
+            return;
+        }
+
+        size_t capacity = this->capacity * 2;
+        if (capacity < MinimumCapacity) {
+            capacity = MinimumCapacity;
+        }
+
+        this->Resize(capacity < count ? count : capacity);
+    }
+
+    // Moves the stored entries into a storage block with exactly the given capacity.
+    CELL_FUNCTION_TEMPLATE void Resize(const size_t capacity) {
+        CELL_ASSERT(capacity >= this->count && capacity > 0);
+
+        if (this->data == nullptr) {
+            this->data = this->AllocateBlock(capacity);
+        } else if constexpr (Utilities::IsTriviallyCopyable<T>) {
+            this->ReallocateBlock(this->capacity, capacity);
+        } else {
+            T* block = this->AllocateBlock(capacity);
+            Memory::Relocate<T>(block, this->data, this->count);
+
+            this->FreeBlock();
+            this->data = block;
+        }
+
+        this->capacity = capacity;
+    }
+
+    // Copies count entries into this list, which has to be empty.
+    CELL_FUNCTION_TEMPLATE void CopyFrom(const T* source, const size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        this->Reserve(count);
+
+        if constexpr (Utilities::IsTriviallyCopyable<T>) {
+            Memory::Copy<T>(this->data, source, count);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                Memory::Construct<T>(this->data + i, source[i]);
+            }
+        }
+
+        this->count = count;
+    }
+
+    // Allocates an uninitialized storage block for count entries.
+    CELL_FUNCTION_TEMPLATE T* AllocateBlock(const size_t count) {
+        if (this->arena != nullptr) {
+            return this->arena->template Allocate<T>(count);
+        }
+
+        CELL_MEMORY_FALLBACK_TAG(Collection);
+        return Memory::AllocateUninitialized<T>(count);
+    }
+
+    CELL_FUNCTION_TEMPLATE void ReallocateBlock(const size_t oldCount, const size_t count) {
+        if (this->arena != nullptr) {
+            this->arena->template Reallocate<T>(this->data, oldCount, count);
+            return;
+        }
+
+        CELL_MEMORY_FALLBACK_TAG(Collection);
+        Memory::Reallocate<T>(this->data, count);
+    }
+
+    CELL_FUNCTION_TEMPLATE void FreeBlock() {
+        if (this->arena != nullptr) {
+            this->arena->Free(this->data);
+            return;
+        }
+
+        Memory::Free(this->data);
+    }
+
+    T* data = nullptr;
+    size_t count = 0;
+    size_t capacity = 0;
+
+    Memory::Arena* arena = nullptr;
 };
 
 }
-
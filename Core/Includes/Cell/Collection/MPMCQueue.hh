@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Construct.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/Utilities/Move.hh>
+
+namespace Cell::Collection {
+
+// Bounded queue that any number of threads may push to and pop from concurrently, without locking (Dmitry Vyukov's design).
+//
+// Every slot carries a sequence number, telling whether it's ready to be written for a given lap around the queue, or to be read.
+// Threads claim a position with a relaxed compare-exchange on the shared counter, and then only touch their claimed slot:
+//  publishing a slot is a release store of its sequence, matched by the acquire load other threads check it with.
+// The capacity is rounded up to a power of two, and must be at least 2.
+template <typename T> class MPMCQueue : public NoCopyObject {
+public:
+    // Creates a queue holding at least the given number of elements.
+    CELL_FUNCTION_TEMPLATE explicit MPMCQueue(const size_t capacity) {
+        CELL_ASSERT(capacity > 1);
+
+        size_t rounded = 2;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+
+        this->slots = Memory::AllocateAligned<Slot>(rounded, Memory::CacheLineSize);
+        this->mask = rounded - 1;
+
+        for (size_t i = 0; i < rounded; i++) {
+            this->slots[i].sequence = i;
+        }
+    }
+
+    // Destructs the remaining elements and frees the queue. No other thread may access the queue anymore.
+    CELL_FUNCTION_TEMPLATE ~MPMCQueue() {
+        for (size_t position = this->consumer.position; position != this->producer.position; position++) {
+            Memory::Destruct<T>(this->slots[position & this->mask].Get());
+        }
+
+        Memory::FreeAligned(this->slots);
+    }
+
+    // Adds a copy of the given element. Returns false if the queue is full.
+    CELL_FUNCTION_TEMPLATE bool Push(const T& element) {
+        Slot* slot = this->ClaimForPush();
+        if (slot == nullptr) {
+            return false;
+        }
+
+        Memory::Construct<T>(slot->Get(), element);
+        this->PublishPush(slot);
+        return true;
+    }
+
+    // Adds the given element by moving it in. Returns false if the queue is full, leaving the element untouched.
+    CELL_FUNCTION_TEMPLATE bool Push(T&& element) {
+        Slot* slot = this->ClaimForPush();
+        if (slot == nullptr) {
+            return false;
+        }
+
+        Memory::Construct<T>(slot->Get(), Utilities::Move(element));
+        this->PublishPush(slot);
+        return true;
+    }
+
+    // Takes out the oldest element. Returns false if the queue is empty.
+    CELL_FUNCTION_TEMPLATE bool Pop(T& element) {
+        size_t position = __atomic_load_n(&this->consumer.position, __ATOMIC_RELAXED);
+
+        Slot* slot = nullptr;
+        while (true) {
+            slot = this->slots + (position & this->mask);
+
+            // a slot holds data for this lap once its sequence is one past the position
+            const size_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+            const intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+            if (difference == 0) {
+                if (__atomic_compare_exchange_n(&this->consumer.position, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = __atomic_load_n(&this->consumer.position, __ATOMIC_RELAXED);
+            }
+        }
+
+        T* stored = slot->Get();
+        element = Utilities::Move(*stored);
+        Memory::Destruct<T>(stored);
+
+        // hand the slot over to the producers of the next lap
+        __atomic_store_n(&slot->sequence, position + this->mask + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // Returns the number of stored elements. With other threads active, this is only an estimate.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
+        const size_t tail = __atomic_load_n(&this->consumer.position, __ATOMIC_RELAXED);
+        const size_t head = __atomic_load_n(&this->producer.position, __ATOMIC_RELAXED);
+
+        return head > tail ? head - tail : 0;
+    }
+
+    // Returns the number of elements the queue can hold.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCapacity() const {
+        return this->mask + 1;
+    }
+
+private:
+    struct Slot {
+        size_t sequence;
+        alignas(T) uint8_t storage[sizeof(T)];
+
+        CELL_FUNCTION_TEMPLATE T* Get() {
+            return (T*)this->storage;
+        }
+    };
+
+    struct alignas(Memory::CacheLineSize) Counter {
+        size_t position;
+    };
+
+    CELL_FUNCTION_TEMPLATE Slot* ClaimForPush() {
+        size_t position = __atomic_load_n(&this->producer.position, __ATOMIC_RELAXED);
+
+        while (true) {
+            Slot* slot = this->slots + (position & this->mask);
+
+            // a slot is free for this lap once its sequence matches the position
+            const size_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+            const intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+            if (difference == 0) {
+                if (__atomic_compare_exchange_n(&this->producer.position, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    return slot;
+                }
+            } else if (difference < 0) {
+                return nullptr;
+            } else {
+                position = __atomic_load_n(&this->producer.position, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    CELL_FUNCTION_TEMPLATE void PublishPush(Slot* slot) {
+        // the claimed position is the sequence this slot was free at
+        const size_t position = __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+    }
+
+    Counter producer = { };
+    Counter consumer = { };
+
+    Slot* slots;
+    size_t mask;
+};
+
+}
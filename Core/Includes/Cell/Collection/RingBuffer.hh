@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/Span.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Utilities/Concepts.hh>
+
+namespace Cell::Collection {
+
+// Bounded queue for passing elements from exactly one producer thread to exactly one consumer thread, without locking.
+//
+// The capacity is rounded up to a power of two. Elements are copied bytewise, so the buffer works just as well over raw bytes,
+//  e.g. audio frames between a capturer and a renderer.
+// Push, PushMany, BeginWrite and CommitWrite must only be called by the producer; Pop, PopMany, BeginRead and CommitRead only by the consumer.
+template <typename T> class RingBuffer : public NoCopyObject {
+    CELL_STATIC_ASSERT(Utilities::IsTriviallyCopyable<T>);
+
+public:
+    // Creates a ring buffer holding at least the given number of elements.
+    CELL_FUNCTION_TEMPLATE explicit RingBuffer(const size_t capacity) {
+        CELL_ASSERT(capacity > 0);
+
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+
+        this->data = Memory::AllocateAligned<T>(rounded, Memory::CacheLineSize);
+        this->mask = rounded - 1;
+    }
+
+    // Frees the storage of the ring buffer.
+    CELL_FUNCTION_TEMPLATE ~RingBuffer() {
+        Memory::FreeAligned(this->data);
+    }
+
+    // Adds an element. Returns false if the buffer is full.
+    CELL_FUNCTION_TEMPLATE bool Push(const T& element) {
+        return this->PushMany(&element, 1) == 1;
+    }
+
+    // Adds as many of the given elements as fit, and returns how many were added.
+    CELL_FUNCTION_TEMPLATE size_t PushMany(const T* CELL_NONNULL elements, const size_t count) {
+        const size_t head = this->producer.position;
+
+        size_t pushed = this->GetWritable(head, count);
+        if (pushed > count) {
+            pushed = count;
+        }
+
+        this->CopyIn(head, elements, pushed);
+
+        __atomic_store_n(&this->producer.position, head + pushed, __ATOMIC_RELEASE);
+        return pushed;
+    }
+
+    // Returns the contiguous free region at the end of the buffer, at most count elements large, for writing elements in place.
+    // It may be smaller than the total free space, as the region ends where the storage wraps around.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Span<T> BeginWrite(const size_t count) {
+        const size_t head = this->producer.position;
+        const size_t index = head & this->mask;
+
+        size_t available = this->GetWritable(head, count);
+        if (available > this->mask + 1 - index) {
+            available = this->mask + 1 - index;
+        }
+
+        return Span<T>(this->data + index, available < count ? available : count);
+    }
+
+    // Publishes the first count elements written to the region returned by BeginWrite.
+    CELL_FUNCTION_TEMPLATE void CommitWrite(const size_t count) {
+        const size_t head = this->producer.position;
+        CELL_ASSERT(count <= this->GetWritable(head, count));
+
+        __atomic_store_n(&this->producer.position, head + count, __ATOMIC_RELEASE);
+    }
+
+    // Takes out the oldest element. Returns false if the buffer is empty.
+    CELL_FUNCTION_TEMPLATE bool Pop(T& element) {
+        return this->PopMany(&element, 1) == 1;
+    }
+
+    // Takes out up to count of the oldest elements, and returns how many were taken.
+    CELL_FUNCTION_TEMPLATE size_t PopMany(T* CELL_NONNULL elements, const size_t count) {
+        const size_t tail = this->consumer.position;
+
+        size_t popped = this->GetReadable(tail, count);
+        if (popped > count) {
+            popped = count;
+        }
+
+        this->CopyOut(tail, elements, popped);
+
+        __atomic_store_n(&this->consumer.position, tail + popped, __ATOMIC_RELEASE);
+        return popped;
+    }
+
+    // Returns the contiguous region of the oldest elements, at most count elements large, for reading them in place.
+    // It may hold fewer than all stored elements, as the region ends where the storage wraps around.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Span<const T> BeginRead(const size_t count) {
+        const size_t tail = this->consumer.position;
+        const size_t index = tail & this->mask;
+
+        size_t available = this->GetReadable(tail, count);
+        if (available > this->mask + 1 - index) {
+            available = this->mask + 1 - index;
+        }
+
+        return Span<const T>(this->data + index, available < count ? available : count);
+    }
+
+    // Releases the first count elements of the region returned by BeginRead, making room for the producer.
+    CELL_FUNCTION_TEMPLATE void CommitRead(const size_t count) {
+        const size_t tail = this->consumer.position;
+        CELL_ASSERT(count <= this->GetReadable(tail, count));
+
+        __atomic_store_n(&this->consumer.position, tail + count, __ATOMIC_RELEASE);
+    }
+
+    // Returns the number of stored elements. With the other thread active, this is only a snapshot.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
+        const size_t tail = __atomic_load_n(&this->consumer.position, __ATOMIC_ACQUIRE);
+        const size_t head = __atomic_load_n(&this->producer.position, __ATOMIC_ACQUIRE);
+
+        return head - tail;
+    }
+
+    // Checks whether the buffer is empty. With the other thread active, this is only a snapshot.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
+    // Returns the number of elements the buffer can hold.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCapacity() const {
+        return this->mask + 1;
+    }
+
+private:
+    // Each side owns a cache line, holding its own position and its last view of the other side's.
+    // Positions only ever increase; they're masked to index the storage.
+    struct alignas(Memory::CacheLineSize) Side {
+        size_t position;
+        size_t otherPosition;
+    };
+
+    // the other side is only queried once the cached view runs out, keeping cache lines from bouncing between cores
+    CELL_FUNCTION_TEMPLATE size_t GetWritable(const size_t head, const size_t wanted) {
+        const size_t capacity = this->mask + 1;
+
+        size_t writable = capacity - (head - this->producer.otherPosition);
+        if (writable < wanted) {
+            this->producer.otherPosition = __atomic_load_n(&this->consumer.position, __ATOMIC_ACQUIRE);
+            writable = capacity - (head - this->producer.otherPosition);
+        }
+
+        return writable;
+    }
+
+    CELL_FUNCTION_TEMPLATE size_t GetReadable(const size_t tail, const size_t wanted) {
+        size_t readable = this->consumer.otherPosition - tail;
+        if (readable < wanted) {
+            this->consumer.otherPosition = __atomic_load_n(&this->producer.position, __ATOMIC_ACQUIRE);
+            readable = this->consumer.otherPosition - tail;
+        }
+
+        return readable;
+    }
+
+    CELL_FUNCTION_TEMPLATE void CopyIn(const size_t position, const T* elements, const size_t count) {
+        const size_t index = position & this->mask;
+        const size_t first = count < this->mask + 1 - index ? count : this->mask + 1 - index;
+
+        if (first > 0) {
+            Memory::Copy<T>(this->data + index, elements, first);
+        }
+
+        if (count > first) {
+            Memory::Copy<T>(this->data, elements + first, count - first);
+        }
+    }
+
+    CELL_FUNCTION_TEMPLATE void CopyOut(const size_t position, T* elements, const size_t count) {
+        const size_t index = position & this->mask;
+        const size_t first = count < this->mask + 1 - index ? count : this->mask + 1 - index;
+
+        if (first > 0) {
+            Memory::Copy<T>(elements, this->data + index, first);
+        }
+
+        if (count > first) {
+            Memory::Copy<T>(elements + first, this->data, count - first);
+        }
+    }
+
+    Side producer = { };
+    Side consumer = { };
+
+    T* data;
+    size_t mask;
+};
+
+}
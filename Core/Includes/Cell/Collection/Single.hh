@@ -8,7 +8,7 @@
 namespace Cell::Collection {
 
 // Shim template to allow single elements to present as enumerable.
-template <typename T> class Single : public IEnumerable<T> {
+template <typename T> class Single : public Object {
 public:
     // Creates a new array from the given block, and assumes its size.
     CELL_FUNCTION_TEMPLATE constexpr Single(T& ref) : element(ref) { }
@@ -17,42 +17,47 @@ public:
     CELL_FUNCTION_TEMPLATE constexpr ~Single() = default;
 
     // Returns the number of elements in the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
         return 1;
     }
 
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
     // Returns the element at the index within the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) {
         CELL_ASSERT(index < 1);
 
         return this->element;
     }
 
     // Returns the element at the index within the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const {
         CELL_ASSERT(index < 1);
 
         return this->element;
     }
 
     // Returns the start address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() {
         return &this->element;
     }
 
     // Returns the end address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() override {
-        return &this->element;
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() {
+        return &this->element + 1;
     }
 
     // Returns the start address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const override {
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const {
         return &this->element;
     }
 
     // Returns the end address of the block.
-    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const override {
-        return &this->element;
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const {
+        return &this->element + 1;
     }
 
 private:
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/Enumerable.hh>
+#include <Cell/Memory/UnownedBlock.hh>
+
+namespace Cell::Collection {
+
+// Non-owning view of contiguously stored elements.
+//
+// It's a plain pointer and count, cheap to pass by value, and created implicitly from any contiguous collection.
+// The storage it views must outlive it; spans created from temporaries are only valid until the end of the expression.
+template <typename T> class Span : public Object {
+public:
+    // Creates an empty span.
+    CELL_FUNCTION_TEMPLATE constexpr Span() : data(nullptr), count(0) { }
+
+    // Creates a span of count elements starting at the given address.
+    CELL_FUNCTION_TEMPLATE constexpr Span(T* CELL_NULLABLE data, const size_t count) : data(data), count(count) { }
+
+    // Creates a span of an entire array.
+    template <size_t S> CELL_FUNCTION_TEMPLATE constexpr Span(T (& array)[S]) : data(array), count(S) { }
+
+    // Creates a span of all elements stored in a contiguous collection.
+    template <typename C> requires ContiguousEnumerable<C, T> CELL_FUNCTION_TEMPLATE constexpr Span(C&& collection)
+        : data(collection.begin()), count(collection.GetCount()) { }
+
+    // Defaulted destructor.
+    CELL_FUNCTION_TEMPLATE constexpr ~Span() = default;
+
+    // Returns the number of elements in the span.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr size_t GetCount() const {
+        return this->count;
+    }
+
+    // Checks whether the span contains no elements.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool IsEmpty() const {
+        return this->count == 0;
+    }
+
+    // Returns the element at the given index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr T& operator [] (const size_t index) const {
+        CELL_ASSERT(index < this->count);
+
+        return this->data[index];
+    }
+
+    // Returns a span of count elements, starting at the given offset into this one.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr Span<T> Slice(const size_t offset, const size_t count) const {
+        CELL_ASSERT(offset + count <= this->count);
+
+        return Span<T>(this->data + offset, count);
+    }
+
+    // Returns the span as a block.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Memory::UnownedBlock<T> AsBlock() const {
+        return Memory::UnownedBlock<T> { this->data, this->count };
+    }
+
+    // Returns the raw pointer to the first element.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr T* CELL_NULLABLE AsRaw() const {
+        return this->data;
+    }
+
+    // Begin operator for foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr T* begin() const {
+        return this->data;
+    }
+
+    // End operator for foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr T* end() const {
+        return this->data + this->count;
+    }
+
+private:
+    T* data;
+    size_t count;
+};
+
+}
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/Enumerable.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Construct.hh>
+#include <Cell/Memory/UnownedBlock.hh>
+#include <Cell/Memory/Virtual.hh>
+#include <Cell/Utilities/Concepts.hh>
+#include <Cell/Utilities/Move.hh>
+
+namespace Cell::Collection {
+
+// List backed by a fixed reservation of address space, which is committed as the list grows.
+//
+// Elements never move, so pointers to them stay valid for as long as they're stored, and growing never copies anything.
+// This makes it suitable for very large lists, with the maximum count set generously; unused address space costs no memory.
+template <typename T> class VirtualList : public Object {
+public:
+    // Reserves address space for up to maximumCount elements. No memory is committed until elements are added.
+    CELL_FUNCTION_TEMPLATE explicit VirtualList(const size_t maximumCount) : maximumCount(maximumCount) {
+        CELL_ASSERT(maximumCount > 0);
+
+        this->reservedSize = Memory::RoundToPageSize(sizeof(T) * maximumCount);
+        this->data = (T*)Memory::VirtualReserve(this->reservedSize);
+    }
+
+    // Destructs every element and releases the reservation of the list.
+    CELL_FUNCTION_TEMPLATE ~VirtualList() {
+        for (size_t i = 0; i < this->count; i++) {
+            Memory::Destruct<T>(this->data + i);
+        }
+
+        Memory::VirtualRelease(this->data, this->reservedSize);
+    }
+
+    // Deletes every object stored and releases the reservation of the list.
+    CELL_FUNCTION_TEMPLATE ~VirtualList() requires Utilities::IsDeletable<T> {
+        for (size_t i = 0; i < this->count; i++) {
+            delete this->data[i];
+        }
+
+        Memory::VirtualRelease(this->data, this->reservedSize);
+    }
+
+    // Appends an element to the end of the list. The list must not be full.
+    CELL_FUNCTION_TEMPLATE void Append(const T& data) {
+        this->EnsureCommitted(this->count + 1);
+
+        Memory::Construct<T>(this->data + this->count++, data);
+    }
+
+    // Appends an element to the end of the list, moving it in. The list must not be full.
+    CELL_FUNCTION_TEMPLATE void Append(T&& data) {
+        this->EnsureCommitted(this->count + 1);
+
+        Memory::Construct<T>(this->data + this->count++, Utilities::Move(data));
+    }
+
+    // Removes the entry at the given index, moving all following entries down by one.
+    CELL_FUNCTION_TEMPLATE void Remove(const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        Memory::Destruct<T>(this->data + index);
+        Memory::Relocate<T>(this->data + index, this->data + index + 1, this->count - index - 1);
+
+        Memory::Clear<T>(this->data + --this->count);
+    }
+
+    // Changes the number of stored entries. New entries are zeroed, or default constructed if they're not trivial.
+    CELL_FUNCTION_TEMPLATE void SetCount(const size_t count) {
+        if (count > this->count) {
+            this->EnsureCommitted(count);
+
+            if constexpr (!Utilities::IsTriviallyCopyable<T>) {
+                for (size_t i = this->count; i < count; i++) {
+                    Memory::Construct<T>(this->data + i);
+                }
+            }
+        } else if (count < this->count) {
+            for (size_t i = count; i < this->count; i++) {
+                Memory::Destruct<T>(this->data + i);
+            }
+
+            // entries past the count have to read back as zero once they're reused
+            Memory::Clear<T>(this->data + count, this->count - count);
+        }
+
+        this->count = count;
+    }
+
+    // Empties the list, returning all of its memory to the system.
+    CELL_FUNCTION_TEMPLATE void Reset() {
+        for (size_t i = 0; i < this->count; i++) {
+            Memory::Destruct<T>(this->data + i);
+        }
+
+        this->count = 0;
+        this->Trim();
+    }
+
+    // Returns the memory past the stored entries to the system.
+    CELL_FUNCTION_TEMPLATE void Trim() {
+        const size_t used = Memory::RoundToPageSize(sizeof(T) * this->count);
+        if (used >= this->committedSize) {
+            return;
+        }
+
+        Memory::VirtualDecommit((uint8_t*)this->data + used, this->committedSize - used);
+        this->committedSize = used;
+    }
+
+    // Returns the number of stored entries.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
+        return this->count;
+    }
+
+    // Checks whether no elements are stored.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
+    // Returns the number of entries the list can hold at most.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetMaximumCount() const {
+        return this->maximumCount;
+    }
+
+    // Returns the number of bytes currently committed.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCommittedSize() const {
+        return this->committedSize;
+    }
+
+    // Retrieves a pointer to a given element. It stays valid until the element is removed.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* GetPointer(const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        return this->data + index;
+    }
+
+    // Retrieves the entry at the specified index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T& operator [] (const size_t index) {
+        CELL_ASSERT(index < this->count);
+
+        return this->data[index];
+    }
+
+    // Retrieves the entry at the specified index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T& operator [] (const size_t index) const {
+        CELL_ASSERT(index < this->count);
+
+        return this->data[index];
+    }
+
+    // Returns this list as a block.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Memory::UnownedBlock<T> AsBlock() {
+        return Memory::UnownedBlock<T> { this->data, this->count };
+    }
+
+    // Returns the raw data pointer for the list.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* AsRaw() {
+        return this->data;
+    }
+
+    // Begin operator for foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* begin() {
+        return this->data;
+    }
+
+    // End operator for foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* end() {
+        return this->data + this->count;
+    }
+
+    // Begin operator for constant foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* begin() const {
+        return this->data;
+    }
+
+    // End operator for constant foreach operations.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const T* end() const {
+        return this->data + this->count;
+    }
+
+private:
+    // Memory is committed at least this many bytes at a time, to keep the number of system calls low.
+    static constexpr size_t MinimumCommitSize = 65536;
+
+    CELL_FUNCTION_TEMPLATE void EnsureCommitted(const size_t count) {
+        CELL_ASSERT(count <= this->maximumCount);
+
+        const size_t required = sizeof(T) * count;
+        if (required <= this->committedSize) {
+            return;
+        }
+
+        // commit geometrically, only pages actually written to take up physical memory anyway
+        size_t target = this->committedSize * 2;
+        if (target < MinimumCommitSize) {
+            target = MinimumCommitSize;
+        }
+
+        if (target < required) {
+            target = required;
+        }
+
+        target = Memory::RoundToPageSize(target);
+        if (target > this->reservedSize) {
+            target = this->reservedSize;
+        }
+
+        Memory::VirtualCommit((uint8_t*)this->data + this->committedSize, target - this->committedSize);
+        this->committedSize = target;
+    }
+
+    T* data;
+    size_t count = 0;
+    const size_t maximumCount;
+
+    size_t reservedSize = 0;
+    size_t committedSize = 0;
+};
+
+}
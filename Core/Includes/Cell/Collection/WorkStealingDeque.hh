@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/Utilities/Concepts.hh>
+
+namespace Cell::Collection {
+
+// Double-ended queue owned by one thread, which other threads can steal elements from (Chase-Lev, with the orderings of Lê et al.).
+//
+// The owner pushes and pops at the bottom, like a stack; thieves take the oldest elements from the top.
+// The owner only synchronizes with thieves when the deque is down to its last element, where a sequentially consistent
+//  compare-exchange on the top decides who gets it. Pushes publish elements with a release fence before moving the bottom,
+//  and thieves read the top and bottom on either side of a sequentially consistent fence.
+// The storage grows as needed. Outgrown buffers are kept until destruction, as thieves might still be reading from them.
+// Elements are read by thieves before they know whether they won them, so they must be trivially copyable and at most 8 bytes large,
+//  e.g. pointers or indices.
+template <typename T> class WorkStealingDeque : public NoCopyObject {
+    CELL_STATIC_ASSERT(Utilities::IsTriviallyCopyable<T> && sizeof(T) <= sizeof(uint64_t));
+
+public:
+    // Creates a deque with room for at least the given number of elements before it grows.
+    CELL_FUNCTION_TEMPLATE explicit WorkStealingDeque(const size_t capacity = 256) {
+        size_t rounded = 2;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+
+        this->buffer = Buffer::Create(rounded, nullptr);
+    }
+
+    // Frees the deque and all buffers it ever used. No other thread may access the deque anymore.
+    CELL_FUNCTION_TEMPLATE ~WorkStealingDeque() {
+        Buffer* buffer = this->buffer;
+        while (buffer != nullptr) {
+            Buffer* previous = buffer->previous;
+            Memory::Free(buffer);
+
+            buffer = previous;
+        }
+    }
+
+    // Adds an element at the bottom. Only the owner may call this.
+    CELL_FUNCTION_TEMPLATE void Push(const T& element) {
+        const int64_t bottom = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED);
+        const int64_t top = __atomic_load_n(&this->top, __ATOMIC_ACQUIRE);
+
+        Buffer* buffer = __atomic_load_n(&this->buffer, __ATOMIC_RELAXED);
+        if (bottom - top > (int64_t)buffer->mask) {
+            buffer = this->Grow(buffer, top, bottom);
+        }
+
+        buffer->Store(bottom, element);
+
+        // the element has to be visible before thieves can see the new bottom
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&this->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    // Takes the most recently pushed element from the bottom. Returns false if the deque is empty. Only the owner may call this.
+    CELL_FUNCTION_TEMPLATE bool Pop(T& element) {
+        const int64_t bottom = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED) - 1;
+        Buffer* buffer = __atomic_load_n(&this->buffer, __ATOMIC_RELAXED);
+
+        // claim the bottom element first, then check whether thieves got to it
+        __atomic_store_n(&this->bottom, bottom, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        int64_t top = __atomic_load_n(&this->top, __ATOMIC_RELAXED);
+        if (top > bottom) {
+            __atomic_store_n(&this->bottom, bottom + 1, __ATOMIC_RELAXED);
+            return false;
+        }
+
+        element = buffer->Load(bottom);
+        if (top < bottom) {
+            return true;
+        }
+
+        // this was the last element; thieves may be racing for it
+        const bool won = __atomic_compare_exchange_n(&this->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+        __atomic_store_n(&this->bottom, bottom + 1, __ATOMIC_RELAXED);
+
+        return won;
+    }
+
+    // Takes the oldest element from the top. Any thread may call this.
+    // Returns false if the deque is empty, or another thread took the element first; callers usually move on to another deque then.
+    CELL_FUNCTION_TEMPLATE bool Steal(T& element) {
+        int64_t top = __atomic_load_n(&this->top, __ATOMIC_ACQUIRE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        const int64_t bottom = __atomic_load_n(&this->bottom, __ATOMIC_ACQUIRE);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        // the element is read before it's claimed, the compare-exchange tells whether it's still ours
+        Buffer* buffer = __atomic_load_n(&this->buffer, __ATOMIC_ACQUIRE);
+        const T stolen = buffer->Load(top);
+
+        if (!__atomic_compare_exchange_n(&this->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            return false;
+        }
+
+        element = stolen;
+        return true;
+    }
+
+    // Returns the number of stored elements. With other threads active, this is only an estimate.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t GetCount() const {
+        const int64_t bottom = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED);
+        const int64_t top = __atomic_load_n(&this->top, __ATOMIC_RELAXED);
+
+        return bottom > top ? (size_t)(bottom - top) : 0;
+    }
+
+    // Checks whether the deque is empty. With other threads active, this is only an estimate.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsEmpty() const {
+        return this->GetCount() == 0;
+    }
+
+private:
+    // Circular storage, with elements accessed atomically, as thieves read them while the owner might be writing.
+    // The elements directly follow the header.
+    struct Buffer {
+        size_t mask;
+        Buffer* previous;
+
+        CELL_FUNCTION_TEMPLATE static Buffer* Create(const size_t capacity, Buffer* previous) {
+            Buffer* buffer = (Buffer*)Memory::AllocateUninitialized(sizeof(Buffer) + sizeof(T) * capacity);
+            buffer->mask = capacity - 1;
+            buffer->previous = previous;
+
+            return buffer;
+        }
+
+        CELL_FUNCTION_TEMPLATE T Load(const int64_t index) {
+            T element;
+            __atomic_load((T*)(this + 1) + (index & this->mask), &element, __ATOMIC_RELAXED);
+            return element;
+        }
+
+        CELL_FUNCTION_TEMPLATE void Store(const int64_t index, T element) {
+            __atomic_store((T*)(this + 1) + (index & this->mask), &element, __ATOMIC_RELAXED);
+        }
+    };
+
+    CELL_FUNCTION_TEMPLATE Buffer* Grow(Buffer* buffer, const int64_t top, const int64_t bottom) {
+        Buffer* grown = Buffer::Create((buffer->mask + 1) * 2, buffer);
+        for (int64_t i = top; i < bottom; i++) {
+            grown->Store(i, buffer->Load(i));
+        }
+
+        __atomic_store_n(&this->buffer, grown, __ATOMIC_RELEASE);
+        return grown;
+    }
+
+    alignas(Memory::CacheLineSize) int64_t top = 0;
+    alignas(Memory::CacheLineSize) int64_t bottom = 0;
+
+    Buffer* buffer;
+};
+
+}
@@ -7,15 +7,38 @@
 
 namespace Cell::Memory {
 
+// Size of a cache line. Data written by different threads should be kept at least this far apart, to avoid false sharing.
+constexpr size_t CacheLineSize = 64;
+
 // Allocates a size bytes large block.
 CELL_FUNCTION void* CELL_NONNULL Allocate(const size_t size);
 
+// Allocates a size bytes large block without clearing it.
+// Meant for buffers that are fully overwritten right away, where zeroing them would be wasted time.
+CELL_FUNCTION void* CELL_NONNULL AllocateUninitialized(const size_t size);
+
 // Reallocates the given block with the new byte size.
 CELL_FUNCTION void Reallocate(void* CELL_NONNULL & block, const size_t size);
 
+// Allocates a size bytes large block aligned to the given power of two. Its contents are left uninitialized.
+// Blocks allocated this way must only be reallocated through ReallocateAligned and freed through FreeAligned.
+CELL_FUNCTION void* CELL_NONNULL AllocateAligned(const size_t size, const size_t alignment);
+
+// Reallocates the given aligned block with the new byte size, keeping its alignment. Any new space is left uninitialized.
+CELL_FUNCTION void ReallocateAligned(void* CELL_NONNULL & block, const size_t oldSize, const size_t size, const size_t alignment);
+
+// Frees the given aligned block.
+CELL_FUNCTION void FreeAligned(const void* CELL_NONNULL block);
+
 // Frees the given block.
 CELL_FUNCTION void Free(const void* CELL_NONNULL block);
 
+// Tag for constructors that should leave their memory uninitialized.
+struct UninitializedTag { };
+
+// Passed to constructors to skip clearing the memory they allocate.
+constexpr UninitializedTag Uninitialized { };
+
 // Copies size bytes from the source address to the destination address.
 CELL_FUNCTION void Copy(void* CELL_NONNULL destination, const void* CELL_NONNULL source, const size_t size);
 
@@ -30,6 +53,21 @@ template <typename T> CELL_FUNCTION_TEMPLATE T* CELL_NONNULL Allocate(const size
     return (T*)Allocate(sizeof(T) * count);
 }
 
+// Allocates a block for count T elements without clearing it.
+template <typename T> CELL_FUNCTION_TEMPLATE T* CELL_NONNULL AllocateUninitialized(const size_t count = 1) {
+    return (T*)AllocateUninitialized(sizeof(T) * count);
+}
+
+// Allocates a block for count T elements, aligned to the given power of two or the alignment of T, whichever is larger.
+template <typename T> CELL_FUNCTION_TEMPLATE T* CELL_NONNULL AllocateAligned(const size_t count, const size_t alignment = alignof(T)) {
+    return (T*)AllocateAligned(sizeof(T) * count, alignment > alignof(T) ? alignment : alignof(T));
+}
+
+// Reallocates the given aligned block from oldCount to count T elements.
+template <typename T> CELL_FUNCTION_TEMPLATE void ReallocateAligned(T* CELL_NONNULL & block, const size_t oldCount, const size_t count, const size_t alignment = alignof(T)) {
+    ReallocateAligned((void*&)block, sizeof(T) * oldCount, sizeof(T) * count, alignment > alignof(T) ? alignment : alignof(T));
+}
+
 // Reallocates the given block with the new count bytes * count.
 template <typename T> CELL_FUNCTION_TEMPLATE void Reallocate(T* CELL_NONNULL & block, const size_t count) {
     Reallocate((void*&)block, sizeof(T) * count);
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::Memory {
+
+// Linear (bump pointer) allocator, handing out memory from large chunks.
+//
+// Freeing single blocks is mostly a no-op; everything is instead released at once, either through Reset or by rewinding to a checkpoint.
+// Chunks are kept around after a reset, so a warmed up arena does not touch the system allocator anymore.
+// Arenas are not thread safe, every thread should use its own.
+class Arena : public NoCopyObject {
+public:
+    // Position within an arena. Rewinding to it releases everything allocated afterwards.
+    struct Checkpoint {
+        void* CELL_NULLABLE chunk;
+        size_t offset;
+    };
+
+    // Creates an arena that allocates chunks of the given byte size. No memory is allocated until it's first needed.
+    CELL_FUNCTION explicit Arena(const size_t chunkSize = 65536);
+
+    // Frees every chunk owned by the arena.
+    CELL_FUNCTION ~Arena();
+
+    // Allocates a block of size bytes, aligned to the given power of two. Its contents are left uninitialized.
+    CELL_NODISCARD CELL_FUNCTION void* CELL_NONNULL Allocate(const size_t size, const size_t alignment = 16);
+
+    // Allocates a zeroed block of size bytes, aligned to the given power of two.
+    CELL_NODISCARD CELL_FUNCTION void* CELL_NONNULL AllocateZeroed(const size_t size, const size_t alignment = 16);
+
+    // Resizes the given block from its old size to the new size. Any added bytes are left uninitialized.
+    // The most recent allocation is resized in place if possible, anything else is copied to a new block with the given alignment.
+    CELL_FUNCTION void Reallocate(void* CELL_NONNULL & block, const size_t oldSize, const size_t size, const size_t alignment = 16);
+
+    // Releases the given block. Only the most recent allocation is actually reclaimed.
+    CELL_FUNCTION void Free(const void* CELL_NONNULL block);
+
+    // Releases all allocations made from this arena.
+    CELL_FUNCTION void Reset();
+
+    // Returns the current position of the arena.
+    CELL_NODISCARD CELL_FUNCTION Checkpoint GetCheckpoint() const;
+
+    // Releases every allocation made after the given checkpoint was taken.
+    CELL_FUNCTION void Rewind(const Checkpoint& checkpoint);
+
+    // Allocates an uninitialized block for count T elements.
+    template <typename T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* CELL_NONNULL Allocate(const size_t count = 1) {
+        return (T*)this->Allocate(sizeof(T) * count, alignof(T) > 16 ? alignof(T) : 16);
+    }
+
+    // Allocates a zeroed block for count T elements.
+    template <typename T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE T* CELL_NONNULL AllocateZeroed(const size_t count = 1) {
+        return (T*)this->AllocateZeroed(sizeof(T) * count, alignof(T) > 16 ? alignof(T) : 16);
+    }
+
+    // Resizes the given block from oldCount to count T elements.
+    template <typename T> CELL_FUNCTION_TEMPLATE void Reallocate(T* CELL_NONNULL & block, const size_t oldCount, const size_t count) {
+        this->Reallocate((void*&)block, sizeof(T) * oldCount, sizeof(T) * count, alignof(T) > 16 ? alignof(T) : 16);
+    }
+
+private:
+    struct Chunk {
+        Chunk* next;
+        size_t capacity;
+    };
+
+    CELL_FUNCTION_INTERNAL uint8_t* GetChunkData(Chunk* chunk) const { return (uint8_t*)(chunk + 1); }
+
+    size_t chunkSize;
+
+    Chunk* first = nullptr;
+    Chunk* current = nullptr;
+    size_t offset = 0;
+
+    void* last = nullptr;
+};
+
+// Rewinds an arena to its state at construction once it goes out of scope.
+class ScopedCheckpoint : public NoCopyObject {
+public:
+    // Records the current position of the arena.
+    CELL_FUNCTION_TEMPLATE explicit ScopedCheckpoint(Arena& arena) : arena(arena), checkpoint(arena.GetCheckpoint()) { }
+
+    // Releases everything allocated from the arena while the scope was alive.
+    CELL_FUNCTION_TEMPLATE ~ScopedCheckpoint() { this->arena.Rewind(this->checkpoint); }
+
+private:
+    Arena& arena;
+    const Arena::Checkpoint checkpoint;
+};
+
+// Pair of arenas for per-frame scratch memory.
+// Allocations stay valid for the frame they were made in and the one after it; flipping releases the older frame's memory.
+class FrameArena : public NoCopyObject {
+public:
+    // Creates both frame arenas with the given chunk size.
+    CELL_FUNCTION_TEMPLATE explicit FrameArena(const size_t chunkSize = 65536) : arenas { Arena(chunkSize), Arena(chunkSize) } { }
+
+    // Returns the arena of the current frame.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Arena& Get() { return this->arenas[this->index]; }
+
+    // Moves on to the next frame, releasing all memory allocated two frames ago.
+    CELL_FUNCTION_TEMPLATE void Flip() {
+        this->index ^= 1;
+        this->arenas[this->index].Reset();
+    }
+
+    // Shorthand for Get.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE operator Arena&() { return this->Get(); }
+
+private:
+    Arena arenas[2];
+    uint8_t index = 0;
+};
+
+}
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Utilities/Concepts.hh>
+#include <Cell/Utilities/Move.hh>
+
+namespace Cell::Memory {
+
+// Selects Cell's own placement new, avoiding any dependency on the standard library's <new>.
+struct PlacementTag { };
+
+}
+
+CELL_FUNCTION_TEMPLATE void* CELL_NONNULL operator new(size_t size, Cell::Memory::PlacementTag, void* CELL_NONNULL address) noexcept {
+    (void)(size);
+    return address;
+}
+
+CELL_FUNCTION_TEMPLATE void operator delete(void* CELL_NONNULL memory, Cell::Memory::PlacementTag, void* CELL_NONNULL address) noexcept {
+    (void)(memory); (void)(address);
+}
+
+namespace Cell::Memory {
+
+// Constructs a T at the given address, passing on the given arguments.
+template <typename T, typename... A> CELL_FUNCTION_TEMPLATE T* CELL_NONNULL Construct(T* CELL_NONNULL address, A&&... arguments) {
+    // the global scope has to be explicit, as Object's operator new would hide it otherwise
+    return ::new (PlacementTag { }, (void*)address) T(Utilities::Forward<A>(arguments)...);
+}
+
+// Destructs the T at the given address, without freeing its memory. This is a no-op for trivial types.
+template <typename T> CELL_FUNCTION_TEMPLATE void Destruct(T* CELL_NONNULL address) {
+    address->~T();
+}
+
+// Moves count Ts from the source to the destination, leaving the source destructed.
+// The destination may overlap with the source, as long as it's located before it.
+template <typename T> CELL_FUNCTION_TEMPLATE void Relocate(T* CELL_NONNULL destination, T* CELL_NONNULL source, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if constexpr (Utilities::IsTriviallyCopyable<T>) {
+            Copy<T>(destination + i, source + i);
+        } else {
+            Construct<T>(destination + i, Utilities::Move(source[i]));
+            Destruct<T>(source + i);
+        }
+    }
+}
+
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Arena.hh>
 #include <Cell/Memory/Block.hh>
 
 namespace Cell::Memory {
@@ -16,16 +17,36 @@ public:
         this->data = Allocate<T>(count);
     }
 
+    // Creates an owned block of memory with the given number of T elements allocated, leaving its contents uninitialized.
+    CELL_FUNCTION_TEMPLATE explicit OwnedBlock(const size_t count, UninitializedTag) : data(nullptr), count(count) {
+        this->data = AllocateUninitialized<T>(count);
+    }
+
+    // Creates an owned, zeroed block of memory from the given arena, with the given number of T elements allocated.
+    // The arena must outlive the block.
+    CELL_FUNCTION_TEMPLATE explicit OwnedBlock(Arena& arena, const size_t count) : data(nullptr), count(count), arena(&arena) {
+        this->data = arena.AllocateZeroed<T>(count);
+    }
+
     // Destructs the block and frees its memory.
     CELL_FUNCTION_TEMPLATE ~OwnedBlock() {
+        if (this->arena != nullptr) {
+            this->arena->Free(this->data);
+            return;
+        }
+
         Free(this->data);
     }
 
     // Resizes the block to the given number of T elements.
     CELL_FUNCTION_TEMPLATE void Resize(const size_t count) override {
-        this->count = count;
+        if (this->arena != nullptr) {
+            this->arena->Reallocate<T>(this->data, this->count, count);
+        } else {
+            Reallocate<T>(this->data, count);
+        }
 
-        Reallocate<T>(this->data, this->count);
+        this->count = count;
     }
 
 // -> IBlock
@@ -40,6 +61,8 @@ public:
 private:
     T* data;
     size_t count;
+
+    Arena* arena = nullptr;
 };
 
 }
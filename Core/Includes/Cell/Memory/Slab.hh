@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::Memory {
+
+// Largest block size in bytes served by the size class slabs. Larger requests are passed on to Allocate.
+constexpr size_t SlabMaximumSize = 512;
+
+// Allocates a zeroed block of size bytes from the size class slabs.
+//
+// Every thread keeps its own cache of free blocks, so allocations are generally served without any locking.
+// Slab memory is never returned to the system, only reused.
+CELL_FUNCTION void* CELL_NONNULL SlabAllocate(const size_t size);
+
+// Returns a block allocated through SlabAllocate. The size has to match the one passed on allocation.
+CELL_FUNCTION void SlabFree(const void* CELL_NONNULL block, const size_t size);
+
+// Hands the free blocks cached by the calling thread over to other threads.
+// Threads started through System::Thread do this once their function returns; other threads have to before exiting, or their cached blocks are lost.
+CELL_FUNCTION void SlabReleaseThreadCache();
+
+}
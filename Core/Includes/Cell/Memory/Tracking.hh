@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::Memory {
+
+// Subsystems allocations are attributed to.
+enum class Tag : uint8_t {
+    General,
+    Collection,
+    String,
+    Slab,
+    Atom,
+    Shell,
+    DataManagement,
+    Renderer,
+    Audio,
+    OpenXR,
+    Network
+};
+
+// Number of available tags.
+constexpr size_t TagCount = (size_t)Tag::Network + 1;
+
+// Allocation statistics for a single tag.
+struct TagStatistics {
+    // Bytes currently allocated.
+    size_t liveBytes;
+
+    // Blocks currently allocated.
+    size_t liveBlocks;
+
+    // Highest number of live bytes since startup, as tracked on every allocation by each thread and combined while sampling.
+    // With several threads allocating, this can come out higher than the actual peak, as their own peaks may not coincide.
+    size_t peakBytes;
+
+    // Number of allocations made since startup.
+    uint64_t allocations;
+
+    // Bytes allocated per second, measured between the last two samples.
+    uint64_t bytesPerSecond;
+
+    // Allocations made per second, measured between the last two samples.
+    uint64_t allocationsPerSecond;
+};
+
+#ifdef CELL_CORE_MEMORY_TRACKING
+
+// Returns the tag new allocations on this thread are attributed to.
+CELL_NODISCARD CELL_FUNCTION Tag GetCurrentTag();
+
+// Sets the tag new allocations on this thread are attributed to, and returns the previous one.
+CELL_FUNCTION Tag SetCurrentTag(const Tag tag);
+
+// Returns a readable name for the given tag.
+CELL_NODISCARD CELL_FUNCTION const char* CELL_NONNULL GetTagName(const Tag tag);
+
+// Aggregates the counters of all threads, updating allocation rates.
+// Meant to be called periodically, e.g. once per frame; peaks in between samples are caught regardless.
+CELL_FUNCTION void SampleTracking();
+
+// Returns the statistics of the given tag as of the last sample.
+CELL_NODISCARD CELL_FUNCTION TagStatistics GetTagStatistics(const Tag tag);
+
+// Logs every tag that still holds memory. Called by the bootstrap once the program exits.
+CELL_FUNCTION void ReportLeaks();
+
+// Attributes allocations on this thread to a tag for as long as it's alive.
+class ScopedTag : public NoCopyObject {
+public:
+    // Switches to the given tag. Fallback tags only apply if no other tag is set, which is useful for containers.
+    CELL_FUNCTION_TEMPLATE explicit ScopedTag(const Tag tag, const bool fallback = false) : previous(GetCurrentTag()) {
+        if (!fallback || this->previous == Tag::General) {
+            SetCurrentTag(tag);
+        }
+    }
+
+    // Restores the previous tag.
+    CELL_FUNCTION_TEMPLATE ~ScopedTag() { SetCurrentTag(this->previous); }
+
+private:
+    const Tag previous;
+};
+
+// Attributes allocations in the current scope to the given tag.
+#define CELL_MEMORY_TAG(t) const Cell::Memory::ScopedTag _cellMemoryTag(Cell::Memory::Tag::t)
+
+// Attributes allocations in the current scope to the given tag, unless an outer scope already set one.
+#define CELL_MEMORY_FALLBACK_TAG(t) const Cell::Memory::ScopedTag _cellMemoryTag(Cell::Memory::Tag::t, true)
+
+#else
+
+#define CELL_MEMORY_TAG(t)
+#define CELL_MEMORY_FALLBACK_TAG(t)
+
+#endif
+
+}
+
+// Hooks used by the platform allocators to keep track of blocks. They reduce to nothing without tracking enabled.
+namespace Cell::Memory::TrackingDetails {
+
+#ifdef CELL_CORE_MEMORY_TRACKING
+
+// Bytes reserved in front of every block for its size and tag.
+constexpr size_t HeaderSize = 16;
+
+// Returns the bytes reserved in front of a block with the given alignment.
+CELL_FUNCTION_TEMPLATE constexpr size_t GetPadding(const size_t alignment) {
+    return alignment > HeaderSize ? alignment : HeaderSize;
+}
+
+// Records a new block of size bytes, starting offset bytes into the given allocation. Returns the block to hand out.
+CELL_FUNCTION_INTERNAL void* CELL_NONNULL Track(void* CELL_NONNULL base, const size_t size, const size_t offset = HeaderSize);
+
+// Records a block that was moved to the given allocation and resized, keeping its tag.
+CELL_FUNCTION_INTERNAL void* CELL_NONNULL Retrack(void* CELL_NONNULL base, const size_t size, const size_t offset = HeaderSize);
+
+// Removes a block from the statistics and returns the allocation it resides in.
+CELL_FUNCTION_INTERNAL void* CELL_NULLABLE Untrack(const void* CELL_NULLABLE block);
+
+#else
+
+constexpr size_t HeaderSize = 0;
+
+CELL_FUNCTION_TEMPLATE constexpr size_t GetPadding(const size_t alignment) {
+    (void)(alignment);
+    return 0;
+}
+
+CELL_FUNCTION_TEMPLATE void* CELL_NONNULL Track(void* CELL_NONNULL base, const size_t size, const size_t offset = 0) {
+    (void)(size); (void)(offset);
+    return base;
+}
+
+CELL_FUNCTION_TEMPLATE void* CELL_NONNULL Retrack(void* CELL_NONNULL base, const size_t size, const size_t offset = 0) {
+    (void)(size); (void)(offset);
+    return base;
+}
+
+CELL_FUNCTION_TEMPLATE void* CELL_NULLABLE Untrack(const void* CELL_NULLABLE block) {
+    return (void*)block;
+}
+
+#endif
+
+}
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::Memory {
+
+// Returns the size of a page, the granularity at which virtual memory is committed and decommitted.
+CELL_NODISCARD CELL_FUNCTION size_t GetPageSize();
+
+// Reserves size bytes of address space without backing them with any memory. The size is rounded up to whole pages.
+// Reserved memory must be committed before it's accessed.
+CELL_NODISCARD CELL_FUNCTION void* CELL_NONNULL VirtualReserve(const size_t size);
+
+// Backs the given page aligned range of reserved address space with zeroed memory.
+CELL_FUNCTION void VirtualCommit(void* CELL_NONNULL address, const size_t size);
+
+// Hands the memory backing the given page aligned range back to the system, while keeping the address space reserved.
+// Committing the range again yields zeroed memory.
+CELL_FUNCTION void VirtualDecommit(void* CELL_NONNULL address, const size_t size);
+
+// Releases a reservation entirely. The size must match the one passed on reservation.
+CELL_FUNCTION void VirtualRelease(void* CELL_NONNULL address, const size_t size);
+
+// Rounds the given size up to whole pages.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE size_t RoundToPageSize(const size_t size) {
+    const size_t pageSize = GetPageSize();
+    return (size + pageSize - 1) & ~(pageSize - 1);
+}
+
+}
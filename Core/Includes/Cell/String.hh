@@ -3,14 +3,27 @@
 
 #pragma once
 
+#include <Cell/StringView.hh>
 #include <Cell/Wrapped.hh>
 #include <Cell/StringDetails/Formatting.hh>
 #include <Cell/StringDetails/Result.hh>
 #include <Cell/StringDetails/RawString.hh>
 
+namespace Cell::Memory { class Arena; }
+namespace Cell::System { class Logger; }
+
 namespace Cell {
 
+namespace StringDetails {
+
+// Number of bytes strings hold inline, without allocating.
+constexpr size_t InlineCapacity = 24;
+
+}
+
 // Represents a block of text, encoded as UTF-8.
+//
+// Short strings are kept inline, and only longer ones allocate. Storage grows geometrically, so appending is amortized constant time.
 class String : public Object {
 public:
     // Creates an empty string.
@@ -19,9 +32,25 @@ public:
     // Creates a string from UTF-8 encoded data. Leaving length 0 makes it check for null termination instead.
     CELL_FUNCTION String(const char* CELL_NONNULL utf8, const size_t length = 0);
 
+    // Creates an empty string, which allocates its contents from the given arena.
+    // The arena must outlive the string.
+    CELL_FUNCTION explicit String(Memory::Arena& arena);
+
+    // Creates a string from UTF-8 encoded data, allocated from the given arena. Leaving length 0 makes it check for null termination instead.
+    // The arena must outlive the string.
+    CELL_FUNCTION String(Memory::Arena& arena, const char* CELL_NONNULL utf8, const size_t length = 0);
+
     // Copies another string.
+    // The copy always uses regular heap memory, as it might outlive the arena of the original.
     CELL_FUNCTION String(const String& string);
 
+    // Copies the text of the given view.
+    CELL_FUNCTION explicit String(const StringView view);
+
+    // Moves another string, leaving it empty.
+    // Contents allocated from an arena are copied instead, for the same reason as with copies.
+    CELL_FUNCTION String(String&& string);
+
     // Destructs the string.
     CELL_FUNCTION ~String();
 
@@ -29,40 +58,68 @@ public:
     CELL_NODISCARD CELL_FUNCTION static Wrapped<String, StringDetails::Result> FromPlatformWideString(const wchar_t* CELL_NONNULL wide);
 
     // Formats the given content into the string.
-    // Use "%" to indicate where to insert an object.
+    // Use "%" to indicate where to insert an object; the number of placeholders is checked against the arguments at compile time.
+    // The size of the result is measured first, so it's written into a single allocation.
+    // Floating point numbers are written in their shortest form that reads back as the same value.
     // TODO: formatting options, like indicating location and how to print specific numbers
-    template <typename... T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE static String Format(const char* format, T&&... args) {
-        return FormatImplementation(format,
-                                    StringDetails::RawStringSize(format),
-                                    (const StringDetails::Formatting::Data[sizeof...(T)]){ StringDetails::Formatting::Package<T>(args)... },
-                                    sizeof...(T));
+    template <typename... T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE static String Format(const StringDetails::Formatting::FormatString<sizeof...(T)> format,
+                                                                                         T&&... args) {
+        CELL_STATIC_ASSERT(sizeof...(T) <= StringDetails::Formatting::MaxArguments, "Too many arguments for a format");
+
+        if constexpr (sizeof...(T) == 0) {
+            return FormatImplementation(format.format, format.length, nullptr, nullptr, 0);
+        } else {
+            const StringDetails::Formatting::Data content[sizeof...(T)] = { StringDetails::Formatting::Package<T>(args)... };
+            return FormatImplementation(format.format, format.length, format.positions, content, sizeof...(T));
+        }
+    }
+
+    // Formats the given content into the given buffer, like Format, without allocating. Returns the number of bytes written.
+    // Fails with NotEnoughMemory if the buffer is too small, in which case nothing is written.
+    template <typename... T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE static Wrapped<size_t, StringDetails::Result>
+    FormatTo(char* CELL_NONNULL buffer, const size_t size, const StringDetails::Formatting::FormatString<sizeof...(T)> format, T&&... args) {
+        CELL_STATIC_ASSERT(sizeof...(T) <= StringDetails::Formatting::MaxArguments, "Too many arguments for a format");
+
+        if constexpr (sizeof...(T) == 0) {
+            return FormatToImplementation(buffer, size, format.format, format.length, nullptr, nullptr, 0);
+        } else {
+            const StringDetails::Formatting::Data content[sizeof...(T)] = { StringDetails::Formatting::Package<T>(args)... };
+            return FormatToImplementation(buffer, size, format.format, format.length, format.positions, content, sizeof...(T));
+        }
     }
 
-    // Appends another string.
-    CELL_FUNCTION StringDetails::Result Append(const String& string);
+    // Appends the given text, e.g. another string or a view.
+    CELL_FUNCTION StringDetails::Result Append(const StringView text);
 
     // Appends UTF-8 encoded text data.
     CELL_FUNCTION StringDetails::Result Append(const char* CELL_NONNULL data);
 
-    // Replaces the contents of the string with new, raw contents. By default, it clears it.
+    // Empties the string, keeping its storage for reuse.
     CELL_FUNCTION void Clear();
 
+    // Makes room for at least the given number of bytes, so appending up to it doesn't allocate.
+    CELL_FUNCTION void Reserve(const size_t capacity);
+
     // Returns the number of bytes inside the string. 0 equals empty.
     CELL_NODISCARD CELL_FUNCTION size_t GetSize() const;
 
+    // Returns the number of bytes the string can hold without allocating.
+    CELL_NODISCARD CELL_FUNCTION size_t GetCapacity() const;
+
     // Returns the number of characters in this string.
     CELL_NODISCARD CELL_FUNCTION size_t GetCount() const;
 
     // Utility function to check whether the string is currently empty.
     CELL_NODISCARD CELL_FUNCTION bool IsEmpty() const;
 
-    // Checks if this string begins with the given substring.
-    CELL_NODISCARD CELL_FUNCTION bool BeginsWith(const String& substring) const;
+    // Checks if this string begins with the given text.
+    CELL_NODISCARD CELL_FUNCTION bool BeginsWith(const StringView text) const;
 
-    // Checks if this string ends with the given
-    CELL_NODISCARD CELL_FUNCTION bool EndsWith(const String& substring) const;
+    // Checks if this string ends with the given text.
+    CELL_NODISCARD CELL_FUNCTION bool EndsWith(const StringView text) const;
 
     // Cuts the string to the given offset and length, from its beginning.
+    // This copies; slicing a view of the string doesn't.
     CELL_NODISCARD CELL_FUNCTION Wrapped<String, StringDetails::Result> Substring(const size_t offset, const size_t length) const;
 
     // Returns a null terminated C char buffer, UTF-8 encoded.
@@ -83,33 +140,41 @@ public:
     // Only implemented on macOS.
     CELL_NODISCARD CELL_FUNCTION NSString* CELL_NONNULL ToPlatformNSString() const;
 
-    // Converts the string in its entirety to a number.
+    // Converts the string in its entirety to a number. See StringView::AsNumber.
     CELL_NODISCARD CELL_FUNCTION Wrapped<uint64_t, StringDetails::Result> AsNumber(const bool isHex = false) const;
 
     // Setting operator overwriting the string contents.
     CELL_FUNCTION String& operator = (const String& input);
 
+    // Moving operator overwriting the string contents, leaving the other string empty.
+    CELL_FUNCTION String& operator = (String&& input);
+
     // CELL_FUNCTION operator overwriting the string contents.
     CELL_FUNCTION String& operator = (const char* input);
 
     // Comparison operator.
-    CELL_NODISCARD CELL_FUNCTION bool operator == (const String& other) const;
+    CELL_NODISCARD CELL_FUNCTION bool operator == (const StringView other) const;
 
     // Comparison operator.
-    CELL_NODISCARD CELL_FUNCTION bool operator != (const String& other) const;
+    CELL_NODISCARD CELL_FUNCTION bool operator != (const StringView other) const;
 
     // Appending operator.
-    CELL_NODISCARD CELL_FUNCTION String operator + (const String& input) const;
+    CELL_NODISCARD CELL_FUNCTION String operator + (const StringView input) const;
 
     // Appending operator for UTF-8 encoded data.
     CELL_NODISCARD CELL_FUNCTION String operator + (const char* input) const;
 
     // Appending operator.
-    CELL_FUNCTION void operator += (const String& input);
+    CELL_FUNCTION void operator += (const StringView input);
 
     // Appending operator for UTF-8 encoded data.
     CELL_FUNCTION void operator += (const char* input);
 
+    // Returns a view of the string's contents, which stays valid until the string is modified or destroyed.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE operator StringView() const {
+        return StringView(this->GetData(), this->size);
+    }
+
     // Per character iterator.
     CELL_NODISCARD CELL_FUNCTION char* begin();
 
@@ -117,10 +182,48 @@ public:
     CELL_NODISCARD CELL_FUNCTION char* end();
 
 private:
-    CELL_FUNCTION static String FormatImplementation(const char* format, const size_t length, const StringDetails::Formatting::Data* content, const size_t count);
+    friend class System::Logger;
+
+    // Placeholder positions may be left out, in which case the format is searched for them.
+    CELL_FUNCTION static String FormatImplementation(const char* format, const size_t length, const size_t* positions,
+                                                     const StringDetails::Formatting::Data* content, const size_t count);
+
+    CELL_FUNCTION static Wrapped<size_t, StringDetails::Result> FormatToImplementation(char* buffer, const size_t size, const char* format, const size_t length,
+                                                                                     const size_t* positions, const StringDetails::Formatting::Data* content,
+                                                                                     const size_t count);
+
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsInline() const {
+        return this->capacity == StringDetails::InlineCapacity;
+    }
+
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE char* GetData() {
+        return this->IsInline() ? this->inlineData : this->data;
+    }
+
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const char* GetData() const {
+        return this->IsInline() ? this->inlineData : this->data;
+    }
+
+    CELL_FUNCTION_INTERNAL void AssignData(const char* data, const size_t size);
+    CELL_FUNCTION_INTERNAL void AppendData(const char* data, const size_t size);
+
+    CELL_FUNCTION_INTERNAL void Grow(const size_t size);
+    CELL_FUNCTION_INTERNAL void SetCapacity(const size_t capacity);
+
+    CELL_FUNCTION_INTERNAL char* AllocateData(const size_t size);
+    CELL_FUNCTION_INTERNAL void ReallocateData(const size_t size);
+    CELL_FUNCTION_INTERNAL void FreeData();
+
+    // heap or arena storage once the string outgrows the inline one, which is the case whenever the capacity exceeds it
+    union {
+        char* data;
+        char inlineData[StringDetails::InlineCapacity];
+    };
+
+    size_t size = 0;
+    size_t capacity = StringDetails::InlineCapacity;
 
-    char* data;
-    size_t size;
+    Memory::Arena* arena = nullptr;
 };
 
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <Cell/Reference.hh>
+#include <Cell/StringView.hh>
 
 namespace Cell { class String; }
 
@@ -29,7 +30,13 @@ enum class Type {
     // Represents the string class.
     CellString,
 
-    FloatingPoint
+    // Represents a string view, i.e. text that isn't null terminated.
+    CellStringView,
+
+    FloatingPoint,
+
+    // Single precision floating point number, stored widened to a double, but written only as precisely as a float needs.
+    SingleFloatingPoint
 };
 
 // Structure holding data relevant formatting.
@@ -43,9 +50,50 @@ struct Data {
         const void* address;
         const double floatingPoint;
         const Reference<const String> string;
+
+        struct {
+            const char* text;
+            size_t size;
+        } view;
     };
 };
 
+// Number of arguments a single format can take.
+constexpr size_t MaxArguments = 32;
+
+// Deliberately left undefined, and not constexpr, so that a mismatched format string fails to compile with this name in the error.
+void FormatPlaceholderCountDoesNotMatchArguments();
+
+// Format string for the given number of arguments, with its "%" placeholders located at compile time.
+// Format strings have to be known at compile time, which string literals always are.
+template <size_t Count> struct FormatString {
+    const char* format;
+    size_t length = 0;
+
+    // Offset of every placeholder within the format.
+    size_t positions[Count > 0 ? Count : 1] = { };
+
+    // Locates the placeholders, and checks that there's one for every argument.
+    consteval FormatString(const char* CELL_NONNULL format) : format(format) {
+        size_t found = 0;
+        for (; format[this->length] != '\0'; this->length++) {
+            if (format[this->length] != '%') {
+                continue;
+            }
+
+            if (found == Count) {
+                FormatPlaceholderCountDoesNotMatchArguments();
+            }
+
+            this->positions[found++] = this->length;
+        }
+
+        if (found != Count) {
+            FormatPlaceholderCountDoesNotMatchArguments();
+        }
+    }
+};
+
 // Template function for implementing storage of various types.
 // Also reminder that C++ reference rules make no sense
 template <typename T> CELL_FUNCTION_TEMPLATE constexpr Data Package(T a);
@@ -76,7 +124,7 @@ IMPL_PRIMITIVE(int64_t, Int, sInt)
 IMPL_PRIMITIVE(size_t, UInt, uInt)
 #endif
 
-IMPL_PRIMITIVE(float, FloatingPoint, floatingPoint)
+IMPL_PRIMITIVE(float, SingleFloatingPoint, floatingPoint)
 IMPL_PRIMITIVE(double, FloatingPoint, floatingPoint)
 
 IMPL_POINTER(char, ConstCharPointer, constCharPointer)
@@ -86,6 +134,16 @@ IMPL_POINTER(void, Address, address)
 template <> CELL_FUNCTION_TEMPLATE constexpr Data Package<String&>(String& value) { return { .type = Type::CellString, .string = value }; }
 template <> CELL_FUNCTION_TEMPLATE constexpr Data Package<const String&>(const String& value) { return { .type = Type::CellString, .string = value }; }
 
+#define IMPL_VIEW(T) \
+template <> CELL_FUNCTION_TEMPLATE constexpr Data Package<T>(T value) { return { .type = Type::CellStringView, .view = { value.ToRawPointer(), value.GetSize() } }; }
+
+IMPL_VIEW(StringView)
+IMPL_VIEW(const StringView)
+IMPL_VIEW(StringView&)
+IMPL_VIEW(const StringView&)
+
+#undef IMPL_VIEW
+
 #ifdef CELL_PLATFORM_WINDOWS
 IMPL_PRIMITIVE(long, Int, sInt)
 IMPL_PRIMITIVE(unsigned long, UInt, uInt)
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::StringDetails {
+
+// Largest number of bytes any of the number conversions below writes.
+constexpr size_t MaxNumberSize = 32;
+
+// Returns the number of decimal digits of the given value.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr size_t CountDigits(uint64_t value) {
+    size_t digits = 1;
+    while (value >= 10000) {
+        value /= 10000;
+        digits += 4;
+    }
+
+    return digits + (value >= 10 ? 1 : 0) + (value >= 100 ? 1 : 0) + (value >= 1000 ? 1 : 0);
+}
+
+// Writes the decimal representation of the given value, and returns the number of bytes written.
+CELL_FUNCTION size_t FormatUnsigned(char* CELL_NONNULL output, const uint64_t value);
+
+// Writes the decimal representation of the given value, and returns the number of bytes written.
+CELL_FUNCTION size_t FormatSigned(char* CELL_NONNULL output, const int64_t value);
+
+// Writes the shortest decimal representation that reads back as exactly the given value, and returns the number of bytes written.
+// Values from 1e-7 up to 1e21 are written plainly, e.g. "0.1" or "1234.5"; others in scientific notation, e.g. "1.5e+25".
+CELL_FUNCTION size_t FormatDouble(char* CELL_NONNULL output, const double value);
+
+// Writes the shortest decimal representation that reads back as exactly the given value at single precision, the same way as FormatDouble.
+CELL_FUNCTION size_t FormatFloat(char* CELL_NONNULL output, const float value);
+
+}
@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Wrapped.hh>
+#include <Cell/StringDetails/RawString.hh>
+#include <Cell/StringDetails/Result.hh>
+
+namespace Cell {
+
+// Refers to a block of UTF-8 encoded text owned by something else, e.g. a String or a literal.
+//
+// Views only consist of a pointer and a size, so they're cheap to pass around and to slice, without ever allocating.
+// The text has to outlive the view, and isn't necessarily null terminated.
+class StringView {
+public:
+    // Value returned by searches that came up empty.
+    static constexpr size_t NotFound = SIZE_MAX;
+
+    // Creates an empty view.
+    CELL_FUNCTION_TEMPLATE constexpr StringView() : data(""), size(0) { }
+
+    // Creates a view of the given text.
+    CELL_FUNCTION_TEMPLATE constexpr StringView(const char* CELL_NONNULL utf8, const size_t size) : data(utf8), size(size) { }
+
+    // Creates a view of the given null terminated text, e.g. a literal.
+    CELL_FUNCTION_TEMPLATE constexpr StringView(const char* CELL_NONNULL utf8) : data(utf8), size(StringDetails::RawStringSize(utf8)) { }
+
+    // Returns the number of bytes in the view. 0 equals empty.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr size_t GetSize() const {
+        return this->size;
+    }
+
+    // Checks whether the view is empty.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool IsEmpty() const {
+        return this->size == 0;
+    }
+
+    // Returns a pointer to the text. It's not necessarily null terminated.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr const char* CELL_NONNULL ToRawPointer() const {
+        return this->data;
+    }
+
+    // Returns the byte at the given offset.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr char operator [] (const size_t index) const {
+        return this->data[index];
+    }
+
+    // Returns a view of part of this one, from the given offset on and with the given length.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Wrapped<StringView, StringDetails::Result> Substring(const size_t offset, const size_t length) const {
+        if (offset > this->size || length > this->size - offset) {
+            return StringDetails::Result::InvalidParameters;
+        }
+
+        return StringView(this->data + offset, length);
+    }
+
+    // Returns a view of everything from the given offset on, or an empty one if the offset is past the end.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr StringView SkipTo(const size_t offset) const {
+        return offset < this->size ? StringView(this->data + offset, this->size - offset) : StringView();
+    }
+
+    // Returns a view of the first count bytes, or all of them if there are fewer.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr StringView Take(const size_t count) const {
+        return StringView(this->data, count < this->size ? count : this->size);
+    }
+
+    // Checks whether this view begins with the given text.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool BeginsWith(const StringView text) const {
+        return text.size <= this->size && StringView(this->data, text.size) == text;
+    }
+
+    // Checks whether this view ends with the given text.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool EndsWith(const StringView text) const {
+        return text.size <= this->size && StringView(this->data + (this->size - text.size), text.size) == text;
+    }
+
+    // Returns the offset of the first occurrence of the given character from the given offset on, or NotFound.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr size_t Find(const char character, const size_t offset = 0) const {
+        for (size_t i = offset; i < this->size; i++) {
+            if (this->data[i] == character) {
+                return i;
+            }
+        }
+
+        return NotFound;
+    }
+
+    // Returns the offset of the first occurrence of the given text from the given offset on, or NotFound.
+    // Empty text is found right at the offset.
+    CELL_NODISCARD CELL_FUNCTION size_t Find(const StringView text, const size_t offset = 0) const;
+
+    // Returns the offset of the last occurrence of the given character, or NotFound.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr size_t FindLast(const char character) const {
+        for (size_t i = this->size; i > 0; i--) {
+            if (this->data[i - 1] == character) {
+                return i - 1;
+            }
+        }
+
+        return NotFound;
+    }
+
+    // Checks whether the given text occurs anywhere in this view.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool Contains(const StringView text) const {
+        return this->Find(text) != NotFound;
+    }
+
+    // Splits the view at the first occurrence of the given separator, into the text before and after it, which both leave it out.
+    // Returns false and leaves both untouched if there's no separator.
+    CELL_FUNCTION_TEMPLATE constexpr bool Split(const char separator, StringView& before, StringView& after) const {
+        const size_t offset = this->Find(separator);
+        if (offset == NotFound) {
+            return false;
+        }
+
+        before = StringView(this->data, offset);
+        after = this->SkipTo(offset + 1);
+        return true;
+    }
+
+    // Returns the text up to the next separator, and moves this view past it; if there's none left, the whole rest is returned.
+    // Repeatedly taking tokens until the view is empty walks through all of them, e.g. the parts of a path.
+    CELL_FUNCTION_TEMPLATE constexpr StringView TakeToken(const char separator) {
+        const size_t offset = this->Find(separator);
+        if (offset == NotFound) {
+            const StringView token = *this;
+            *this = StringView();
+            return token;
+        }
+
+        const StringView token(this->data, offset);
+        *this = StringView(this->data + offset + 1, this->size - offset - 1);
+        return token;
+    }
+
+    // Returns a view without the spaces, tabs and line breaks at either end.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr StringView Trim() const {
+        size_t start = 0;
+        size_t end = this->size;
+
+        while (start < end && IsSpace(this->data[start])) {
+            start++;
+        }
+
+        while (end > start && IsSpace(this->data[end - 1])) {
+            end--;
+        }
+
+        return StringView(this->data + start, end - start);
+    }
+
+    // Converts the view in its entirety to an unsigned number, decimal or hexadecimal.
+    // Fails with InvalidFormat if it's empty, has anything but digits in it, or the number doesn't fit.
+    CELL_NODISCARD CELL_FUNCTION Wrapped<uint64_t, StringDetails::Result> AsNumber(const bool isHex = false) const;
+
+    // Converts the view in its entirety to a signed decimal number, which may start with a sign.
+    // Fails with InvalidFormat if it's empty, has anything but digits in it, or the number doesn't fit.
+    CELL_NODISCARD CELL_FUNCTION Wrapped<int64_t, StringDetails::Result> AsSignedNumber() const;
+
+    // Converts the view in its entirety to a floating point number, e.g. "-1.5e3".
+    // Fails with InvalidFormat if it's empty or isn't a number as a whole.
+    CELL_NODISCARD CELL_FUNCTION Wrapped<double, StringDetails::Result> AsDouble() const;
+
+    // Comparison operator.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool operator == (const StringView other) const {
+        return this->size == other.size && __builtin_memcmp(this->data, other.data, this->size) == 0;
+    }
+
+    // Comparison operator.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr bool operator != (const StringView other) const {
+        return !(*this == other);
+    }
+
+    // Per character iterator.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr const char* begin() const {
+        return this->data;
+    }
+
+    // Per character iterator.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr const char* end() const {
+        return this->data + this->size;
+    }
+
+private:
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE static constexpr bool IsSpace(const char character) {
+        return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+    }
+
+    const char* data;
+    size_t size;
+};
+
+}
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/System/Mutex.hh>
+#include <Cell/System/Result.hh>
+
+namespace Cell::System {
+
+// Lets threads sleep until another thread notifies them of a change to state protected by a mutex.
+//
+// Wakeups can be spurious, so waiters have to check their condition again in a loop, with the mutex locked.
+// Notifying without any waiters doesn't make a syscall.
+class ConditionVariable : public NoCopyObject {
+public:
+    // Creates a new condition variable.
+    CELL_FUNCTION_TEMPLATE constexpr ConditionVariable() = default;
+
+    // Releases the condition variable. No thread may be waiting on it anymore.
+    CELL_FUNCTION_TEMPLATE constexpr ~ConditionVariable() = default;
+
+    // Unlocks the mutex, which must be locked by the calling thread, and waits for a notification or the timeout in milliseconds to expire.
+    // The mutex is locked again before returning. By default, it blocks forever.
+    CELL_FUNCTION Result Wait(Mutex& mutex, const uint32_t timeoutMs = 0);
+
+    // Wakes up one waiting thread.
+    CELL_FUNCTION void Signal();
+
+    // Wakes up all waiting threads.
+    CELL_FUNCTION void Broadcast();
+
+private:
+    uint32_t sequence = 0;
+    uint32_t waiters = 0;
+};
+
+}
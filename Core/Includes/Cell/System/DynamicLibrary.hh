@@ -4,7 +4,7 @@
 #pragma once
 
 #include <Cell/String.hh>
-#include <Cell/Collection/Dictionary.hh>
+#include <Cell/Collection/HashMap.hh>
 #include <Cell/System/Result.hh>
 
 namespace Cell::System {
@@ -28,7 +28,7 @@ private:
     CELL_FUNCTION_INTERNAL DynamicLibrary(uintptr_t i) : impl(i) { }
 
     uintptr_t impl;
-    Collection::Dictionary<String, GenericFunctionPointer> loadedFunctions;
+    Collection::HashMap<String, GenericFunctionPointer> loadedFunctions;
 };
 
 }
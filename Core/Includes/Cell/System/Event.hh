@@ -9,26 +9,55 @@
 namespace Cell::System {
 
 // Represents an event. Can be signaled, useful as a semaphore for operation.
+//
+// Once signaled, the event stays signaled, letting every waiter through, until it's reset.
+// The state is a single word inside the object; waiting on a signaled event and signaling one nobody waits for don't make syscalls.
 class Event : public NoCopyObject {
 public:
     // Creates a new event.
-    CELL_FUNCTION Event(const bool createSignaled = false);
+    CELL_FUNCTION_TEMPLATE constexpr Event(const bool createSignaled = false) : state(createSignaled ? Signaled : Unsignaled) { }
 
     // Releases the event.
-    CELL_FUNCTION ~Event();
+    CELL_FUNCTION_TEMPLATE constexpr ~Event() = default;
 
     // Signals the event.
-    CELL_FUNCTION void Signal();
+    CELL_FUNCTION_TEMPLATE void Signal() {
+        if (__atomic_exchange_n(&this->state, Signaled, __ATOMIC_RELEASE) == UnsignaledWithWaiters) {
+            this->WakeWaiters();
+        }
+    }
 
     // Resets the event.
-    CELL_FUNCTION void Reset();
+    CELL_FUNCTION_TEMPLATE void Reset() {
+        // waiters may have marked the event in the meantime; it's unsignaled either way
+        uint32_t expected = Signaled;
+        __atomic_compare_exchange_n(&this->state, &expected, Unsignaled, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
 
     // Waits for the event to be signaled with the given timeout.
     // By default, it blocks forever until the event is signaled.
-    CELL_FUNCTION Result Wait(const uint32_t timeoutMs = 0);
+    CELL_FUNCTION_TEMPLATE Result Wait(const uint32_t timeoutMs = 0) {
+        if (__atomic_load_n(&this->state, __ATOMIC_ACQUIRE) == Signaled) {
+            return Result::Success;
+        }
+
+        return this->WaitContended(timeoutMs);
+    }
+
+    // Checks whether the event is signaled, without waiting for it.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsSignaled() const {
+        return __atomic_load_n(&this->state, __ATOMIC_ACQUIRE) == Signaled;
+    }
 
 private:
-    uintptr_t impl;
+    static constexpr uint32_t Unsignaled            = 0;
+    static constexpr uint32_t Signaled              = 1;
+    static constexpr uint32_t UnsignaledWithWaiters = 2;
+
+    CELL_FUNCTION Result WaitContended(const uint32_t timeoutMs);
+    CELL_FUNCTION void WakeWaiters();
+
+    uint32_t state;
 };
 
 }
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/Span.hh>
+
+namespace Cell::System {
+
+// Number of buckets in the jitter histogram of a frame pacer.
+constexpr uint32_t FramePacerJitterBuckets = 16;
+
+// Wakes a loop up at a fixed interval, or at given deadlines, within a few microseconds.
+//
+// Most of the wait is slept away on an absolute deadline, and the rest is spun, as the scheduler usually wakes threads up late.
+// How much is spun is calibrated continuously from how late the sleeps actually wake up.
+// Frames are scheduled from the previous deadline rather than the actual wake-up, so lateness doesn't accumulate.
+// How late each wait finished is recorded in a histogram with power of two buckets, i.e. bucket n counts waits that were
+//  less than 2^n microseconds late, with the last bucket also counting anything later.
+class FramePacer : public NoCopyObject {
+public:
+    // Creates a pacer for the given frame interval in microseconds. The first frame starts one interval from now.
+    CELL_FUNCTION explicit FramePacer(const uint64_t interval);
+
+    // Waits until the next frame starts, and returns the time the wait finished at.
+    // If the frame is already more than an interval late, the schedule restarts from now rather than trying to catch up.
+    CELL_FUNCTION uint64_t Wait();
+
+    // Waits until the precise timer reaches the given deadline, and returns the time the wait finished at.
+    // Does not affect the frame schedule.
+    CELL_FUNCTION uint64_t WaitUntil(const uint64_t deadline);
+
+    // Restarts the frame schedule from now, e.g. after the loop was paused.
+    CELL_FUNCTION void Reset();
+
+    // Changes the frame interval, in microseconds. The schedule carries on, with the upcoming frame starting one new interval after the previous one.
+    CELL_FUNCTION void SetInterval(const uint64_t interval);
+
+    // Changes the frame interval to the given frequency in Hz, keeping the schedule.
+    CELL_FUNCTION_TEMPLATE void SetRate(const uint32_t hertz) {
+        this->SetInterval(1000000 / hertz);
+    }
+
+    // Returns the frame interval, in microseconds.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t GetInterval() const {
+        return this->interval;
+    }
+
+    // Returns how long each wait is currently spun for at the end, in microseconds.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t GetSpinMargin() const {
+        return this->spinMargin;
+    }
+
+    // Returns the number of frames that started late by more than an interval.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t GetMissedFrameCount() const {
+        return this->missedFrames;
+    }
+
+    // Returns the histogram of how late waits finished.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Collection::Span<const uint64_t> GetJitterHistogram() const {
+        return Collection::Span<const uint64_t>(this->jitter, FramePacerJitterBuckets);
+    }
+
+    // Clears the jitter histogram and missed frame count.
+    CELL_FUNCTION void ResetStatistics();
+
+private:
+    uint64_t interval;
+    uint64_t next;
+    uint64_t spinMargin;
+
+    uint64_t missedFrames = 0;
+    uint64_t jitter[FramePacerJitterBuckets] = { };
+};
+
+}
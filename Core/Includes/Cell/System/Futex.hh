@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/System/Result.hh>
+
+namespace Cell::System {
+
+// Blocks while the value at the given address equals the expected one, until woken up through FutexWake or FutexWakeAll,
+//  or the timeout in milliseconds expires. By default, it blocks forever.
+// The comparison and going to sleep are atomic with respect to waking. Wakeups can be spurious; callers have to check their condition again.
+// Returns Timeout if the timeout expired, and Success otherwise.
+CELL_FUNCTION Result FutexWait(const uint32_t* CELL_NONNULL address, const uint32_t expected, const uint32_t timeoutMs = 0);
+
+// Wakes up one thread blocked on the given address.
+CELL_FUNCTION void FutexWake(const uint32_t* CELL_NONNULL address);
+
+// Wakes up all threads blocked on the given address.
+CELL_FUNCTION void FutexWakeAll(const uint32_t* CELL_NONNULL address);
+
+// Hints to the processor that the calling thread is spinning, e.g. while waiting for a lock.
+CELL_FUNCTION_TEMPLATE void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+}
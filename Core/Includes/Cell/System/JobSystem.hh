@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/MPMCQueue.hh>
+#include <Cell/Utilities/Move.hh>
+
+namespace Cell::System {
+
+// Prototype definition for a job function.
+typedef void (* JobFunction)(void* CELL_NULLABLE parameter);
+
+// Prototype definition for a function processing the index range [begin, end).
+typedef void (* JobRangeFunction)(const size_t begin, const size_t end, void* CELL_NULLABLE parameter);
+
+namespace JobSystemDetails {
+struct Job;
+struct Worker;
+}
+
+// Counts jobs that have yet to finish.
+// Jobs can be made to depend on a counter, starting once it reaches zero; the job system can also be waited on until then.
+class JobCounter : public NoCopyObject {
+public:
+    // Creates a counter with no jobs.
+    CELL_FUNCTION_TEMPLATE JobCounter() = default;
+
+    // Checks whether all jobs counted by this counter have finished.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsDone() const {
+        // the lock is read last; a counter only counts as done once whoever brought it to zero let go of it
+        return __atomic_load_n(&this->value, __ATOMIC_ACQUIRE) == 0 && __atomic_load_n(&this->lock, __ATOMIC_ACQUIRE) == 0;
+    }
+
+private:
+    friend class JobSystem;
+
+    uint32_t value = 0;
+    uint32_t lock = 0;
+    JobSystemDetails::Job* waiting = nullptr;
+};
+
+// Runs jobs across a set of worker threads.
+//
+// Every worker owns a work-stealing deque; jobs queued from a worker go to its own deque, jobs from any other thread to a shared queue.
+// Idle workers steal from each other before going to sleep, and are woken up again as jobs are queued.
+// Waiting on a counter runs queued jobs on the calling thread, rather than blocking it.
+class JobSystem : public NoCopyObject {
+public:
+    // Starts the given number of workers. By default, there's one per logical processor besides the calling thread,
+    //  as it usually helps out while waiting.
+    CELL_FUNCTION explicit JobSystem(const uint32_t workerCount = 0);
+
+    // Stops the workers, and runs whatever jobs are still queued on the calling thread.
+    // Jobs depending on counters that never reach zero are dropped.
+    CELL_FUNCTION ~JobSystem();
+
+    // Queues a job. The counter, if given, is incremented right away, and decremented once the job has finished.
+    CELL_FUNCTION void Run(JobFunction CELL_NONNULL function, void* CELL_NULLABLE parameter = nullptr, JobCounter* CELL_NULLABLE counter = nullptr);
+
+    // Queues a job once the dependency reaches zero, or right away if it already has.
+    // The counter, if given, is incremented right away, and decremented once the job has finished.
+    CELL_FUNCTION void RunAfter(JobCounter& dependency, JobFunction CELL_NONNULL function, void* CELL_NULLABLE parameter = nullptr,
+                                JobCounter* CELL_NULLABLE counter = nullptr);
+
+    // Counts work other than a job towards the counter, e.g. a running coroutine. Every call has to be matched by a call to Finish.
+    CELL_FUNCTION void Track(JobCounter& counter);
+
+    // Decrements the counter for work counted through Track, queueing the jobs depending on it once it reaches zero.
+    CELL_FUNCTION void Finish(JobCounter& counter);
+
+    // Runs queued jobs on the calling thread until the counter reaches zero.
+    CELL_FUNCTION void Wait(JobCounter& counter);
+
+    // Splits the index range [0, count) into batches of up to batchSize indices, runs the function for each of them across the workers,
+    //  and waits for all of them to finish.
+    CELL_FUNCTION void ParallelFor(const size_t count, const size_t batchSize, JobRangeFunction CELL_NONNULL function, void* CELL_NULLABLE parameter = nullptr);
+
+    // Splits the index range [0, count) into batches of up to batchSize indices, calls function(begin, end) for each of them across the workers,
+    //  and waits for all of them to finish.
+    template <typename F> CELL_FUNCTION_TEMPLATE void ParallelFor(const size_t count, const size_t batchSize, F&& function) {
+        using Function = typename Utilities::RemoveReferenceType<F>::Type;
+
+        this->ParallelFor(count, batchSize, [](const size_t begin, const size_t end, void* parameter) {
+            (*(Function*)parameter)(begin, end);
+        }, (void*)&function);
+    }
+
+    // Returns the number of worker threads.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint32_t GetWorkerCount() const {
+        return this->workerCount;
+    }
+
+private:
+    CELL_FUNCTION_INTERNAL void Submit(JobSystemDetails::Job* CELL_NONNULL job);
+    CELL_FUNCTION_INTERNAL void Execute(JobSystemDetails::Job* CELL_NONNULL job);
+    CELL_FUNCTION_INTERNAL void Complete(JobCounter& counter);
+    CELL_FUNCTION_INTERNAL void WakeOne();
+
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL JobSystemDetails::Job* CELL_NULLABLE FindJob(JobSystemDetails::Worker* CELL_NULLABLE self);
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL JobSystemDetails::Worker* CELL_NULLABLE GetCurrentWorker() const;
+
+    CELL_FUNCTION_INTERNAL void RunWorker(JobSystemDetails::Worker* CELL_NONNULL worker);
+
+    Collection::MPMCQueue<JobSystemDetails::Job*> injected;
+
+    JobSystemDetails::Worker* workers;
+    uint32_t workerCount;
+
+    int32_t pending = 0;
+    uint32_t nextVictim = 0;
+    bool running = true;
+};
+
+}
@@ -4,24 +4,70 @@
 #pragma once
 
 #include <Cell/String.hh>
+#include <Cell/System/Panic.hh>
 
 namespace Cell::System {
 
+// Severity of a log message.
+enum class LogLevel : uint8_t {
+    // Details only useful while debugging.
+    Debug,
+
+    // Regular messages.
+    Info,
+
+    // Something went wrong, but could be handled.
+    Warning,
+
+    // Something went wrong, and couldn't be handled.
+    Error
+};
+
+namespace LogDetails {
+
+// Number of arguments a single message can be formatted with.
+constexpr size_t MaxArguments = 16;
+
+// Queues a message with the active logger, or formats and writes it right away if there's none.
+CELL_FUNCTION void Submit(const LogLevel level, const char* CELL_NONNULL format, const StringDetails::Formatting::Data* CELL_NULLABLE arguments,
+                          const size_t count);
+
+}
+
 // Logs a message.
 //
 // The target is determined in core; formatting should be kept minimal.
 // Every message is separated as appropriate for the given logging implementation,
 //  e.g newlines are appended automatically for a plain text log to console or a file)
+// The message is written right away on the calling thread, even while a Logger is active.
 CELL_FUNCTION void Log(const String& message);
 
 // Stinky utility because C/C++ really don't like us.
+// Goes through the active Logger, if there is one.
 CELL_FUNCTION_TEMPLATE void Log(const char* message) {
-    Log(String(message));
+    const StringDetails::Formatting::Data argument = StringDetails::Formatting::Package<const char*>(message);
+    LogDetails::Submit(LogLevel::Info, "%", &argument, 1);
+}
+
+// Utility to auto-format messages, at the given level.
+//
+// While a Logger is active, only the arguments are captured on the calling thread, and formatting happens on the logger thread.
+// The format itself isn't copied, and has to stay valid until then, which string literals always do.
+// Like with String::Format, the number of placeholders is checked against the arguments at compile time.
+template <typename... T> CELL_FUNCTION_TEMPLATE void Log(const LogLevel level, const StringDetails::Formatting::FormatString<sizeof...(T)> format, T&&... args) {
+    CELL_STATIC_ASSERT(sizeof...(T) <= LogDetails::MaxArguments, "Too many arguments for a log message");
+
+    if constexpr (sizeof...(T) == 0) {
+        LogDetails::Submit(level, format.format, nullptr, 0);
+    } else {
+        const StringDetails::Formatting::Data arguments[sizeof...(T)] = { StringDetails::Formatting::Package<T>(args)... };
+        LogDetails::Submit(level, format.format, arguments, sizeof...(T));
+    }
 }
 
 // Utility to auto-format messages.
-template <typename... T> CELL_FUNCTION_TEMPLATE void Log(const char* format, T&&... args) {
-    Log(String::Format(format, args...));
+template <typename... T> CELL_FUNCTION_TEMPLATE void Log(const StringDetails::Formatting::FormatString<sizeof...(T)> format, T&&... args) {
+    Log(LogLevel::Info, format, args...);
 }
 
 }
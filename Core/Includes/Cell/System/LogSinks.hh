@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/IO/File.hh>
+#include <Cell/System/Logger.hh>
+
+namespace Cell::System {
+
+// Returns the name of the given log level.
+CELL_NODISCARD CELL_FUNCTION const char* CELL_NONNULL GetLogLevelName(const LogLevel level);
+
+// Writes messages to the platform's log output, i.e. the same place System::Log(String) writes to.
+class ConsoleLogSink : public ILogSink {
+public:
+    // Creates a console sink, writing messages of at least the given level.
+    CELL_FUNCTION explicit ConsoleLogSink(const LogLevel minimumLevel = LogLevel::Debug);
+
+    CELL_FUNCTION void Write(const LogLevel level, const uint64_t timestamp, const String& message) override;
+
+private:
+    LogLevel minimumLevel;
+};
+
+// Writes messages to a set of files, moving on to the next one once the current one reaches its size limit.
+//
+// The files are named after the given path, with their number appended, e.g. "Cell.log.0", "Cell.log.1".
+// Once the last one is full, the first one is overwritten, so there's always at most the given number of files.
+class RotatingFileLogSink : public ILogSink {
+public:
+    // Creates a sink writing to files of at most the given size in bytes, starting with the first one, overwriting it.
+    CELL_FUNCTION static Wrapped<RotatingFileLogSink*, IO::Result> Create(const String& path, const size_t maxSize = 4 * 1024 * 1024,
+                                                                         const uint32_t fileCount = 4);
+
+    // Flushes and closes the current file.
+    CELL_FUNCTION ~RotatingFileLogSink() override;
+
+    CELL_FUNCTION void Write(const LogLevel level, const uint64_t timestamp, const String& message) override;
+
+    CELL_FUNCTION void Flush() override;
+
+private:
+    CELL_FUNCTION_INTERNAL RotatingFileLogSink(const String& path, const size_t maxSize, const uint32_t fileCount, IO::File* file)
+        : path(path), maxSize(maxSize), fileCount(fileCount), file(file) { }
+
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL static Wrapped<IO::File*, IO::Result> OpenFile(const String& path, const uint32_t index);
+
+    String path;
+    size_t maxSize;
+    uint32_t fileCount;
+
+    IO::File* file;
+    uint32_t index = 0;
+    size_t written = 0;
+};
+
+// Keeps the most recent messages in memory, e.g. for an in-game console or crash reports.
+class MemoryLogSink : public ILogSink {
+public:
+    // Creates a sink keeping the given number of messages.
+    CELL_FUNCTION explicit MemoryLogSink(const size_t capacity = 256);
+
+    CELL_FUNCTION void Write(const LogLevel level, const uint64_t timestamp, const String& message) override;
+
+    // Returns a copy of the kept messages, oldest first. Safe to call from any thread.
+    CELL_NODISCARD CELL_FUNCTION Collection::List<String> GetMessages();
+
+private:
+    Collection::List<String> messages;
+    size_t capacity;
+    size_t next = 0;
+
+    Mutex lock;
+};
+
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/List.hh>
+#include <Cell/System/Event.hh>
+#include <Cell/System/Log.hh>
+#include <Cell/System/Mutex.hh>
+
+namespace Cell::System {
+
+class Thread;
+
+namespace LoggerDetails {
+struct Buffer;
+struct Record;
+}
+
+// Receives formatted messages from a logger.
+class ILogSink : public NoCopyObject {
+public:
+    virtual ~ILogSink() = default;
+
+    // Writes a message. The timestamp is in microseconds since the logger started.
+    // Only ever called from the logger thread.
+    virtual void Write(const LogLevel level, const uint64_t timestamp, const String& message) = 0;
+
+    // Writes out anything buffered. Called whenever the logger has caught up.
+    virtual void Flush() { }
+};
+
+// Moves logging off the threads doing it.
+//
+// While a logger exists, System::Log only captures the format and arguments into a buffer of the calling thread, which takes no locks
+//  and never blocks. Strings are copied in, so they don't need to outlive the call.
+// A background thread collects the messages from all buffers, formats them in the order they were logged, and hands them to the sinks.
+// Messages that don't fit into a full buffer are dropped, and reported as such once there's room again.
+// Only one logger can exist at a time.
+class Logger : public NoCopyObject {
+public:
+    // Starts the logger thread. Every thread logging gets a buffer of the given size in bytes.
+    CELL_FUNCTION explicit Logger(const size_t bufferSize = 64 * 1024);
+
+    // Writes out all remaining messages and stops the logger thread.
+    // Other threads must have stopped logging before, and buffers are only freed here, so they outlive the threads they belong to.
+    CELL_FUNCTION ~Logger();
+
+    // Adds a sink, taking ownership of it.
+    CELL_FUNCTION void AddSink(ILogSink* CELL_NONNULL sink);
+
+    // Blocks until all messages logged before the call have been written to the sinks.
+    CELL_FUNCTION void Flush();
+
+    // Returns the number of messages dropped due to full buffers.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetDroppedCount() const;
+
+private:
+    friend void LogDetails::Submit(const LogLevel, const char*, const StringDetails::Formatting::Data*, const size_t);
+
+    CELL_FUNCTION_INTERNAL void Enqueue(const LogLevel level, const char* format, const StringDetails::Formatting::Data* arguments, const size_t count);
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL LoggerDetails::Buffer* GetBuffer();
+
+    CELL_FUNCTION_INTERNAL void Run();
+    CELL_FUNCTION_INTERNAL bool Drain();
+    CELL_FUNCTION_INTERNAL void Write(const LogLevel level, const uint64_t timestamp, const String& message);
+    CELL_FUNCTION_INTERNAL void FlushSinks();
+
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL static String Format(const LoggerDetails::Record* CELL_NONNULL record);
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL static String Format(const char* CELL_NONNULL format, const StringDetails::Formatting::Data* CELL_NULLABLE arguments,
+                                                               const size_t count);
+
+    size_t bufferSize;
+    uint64_t generation;
+    uint64_t startTicks;
+
+    // buffers of all threads that have logged, pushed as a stack
+    LoggerDetails::Buffer* buffers = nullptr;
+
+    Collection::List<ILogSink*> sinks;
+    Mutex sinkLock;
+
+    // records collected from all buffers on the logger thread, for sorting them before formatting
+    Collection::List<uint8_t> records;
+
+    Thread* thread;
+    Event wake;
+
+    uint32_t flushRequests = 0;
+    uint32_t flushedThrough = 0;
+
+    uint64_t dropped = 0;
+    bool running = true;
+};
+
+}
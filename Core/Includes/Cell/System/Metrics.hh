@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/String.hh>
+#include <Cell/Collection/List.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/System/Ticks.hh>
+
+namespace Cell::System {
+
+namespace MetricsDetails {
+
+// Number of shards every counter and histogram is split into; threads are spread across them.
+constexpr uint32_t ShardCount = 16;
+
+// Values below this are counted exactly by histograms; above, every power of two is split into half as many buckets.
+constexpr uint32_t SubBucketBits = 8;
+constexpr uint64_t SubBucketCount = 1ull << SubBucketBits;
+constexpr uint64_t SubBucketHalf = SubBucketCount / 2;
+
+// Largest value histograms tell apart is 2^MaxValueBits - 1; larger ones are counted as that.
+constexpr uint32_t MaxValueBits = 40;
+
+// Number of buckets a histogram consists of.
+constexpr size_t BucketCount = SubBucketCount + (MaxValueBits - SubBucketBits) * SubBucketHalf;
+
+struct alignas(Memory::CacheLineSize) CounterShard {
+    uint64_t value;
+};
+
+struct HistogramShard;
+
+// Assigns the calling thread a shard, round robin.
+CELL_NODISCARD CELL_FUNCTION uint32_t AssignShard();
+
+// Returns the shard of the calling thread.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint32_t GetShard() {
+    static thread_local uint32_t shard = 0;
+
+    // zero means there's none yet, so shards are stored off by one
+    if (shard == 0) {
+        shard = AssignShard() + 1;
+    }
+
+    return shard - 1;
+}
+
+// Returns the histogram bucket of the given value.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr size_t GetBucket(uint64_t value) {
+    if (value < SubBucketCount) {
+        return (size_t)value;
+    }
+
+    if (value >> MaxValueBits != 0) {
+        value = (1ull << MaxValueBits) - 1;
+    }
+
+    const uint32_t magnitude = 63 - (uint32_t)__builtin_clzll(value);
+    const uint32_t shift = magnitude - SubBucketBits + 1;
+
+    return (size_t)(SubBucketCount + (magnitude - SubBucketBits) * SubBucketHalf + ((value >> shift) - SubBucketHalf));
+}
+
+// Returns the largest value counted in the given histogram bucket.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr uint64_t GetBucketLimit(const size_t bucket) {
+    if (bucket < SubBucketCount) {
+        return bucket;
+    }
+
+    const uint64_t offset = bucket - SubBucketCount;
+    const uint32_t shift = (uint32_t)(offset / SubBucketHalf) + 1;
+    const uint64_t sub = SubBucketHalf + offset % SubBucketHalf;
+
+    return ((sub + 1) << shift) - 1;
+}
+
+}
+
+// Kinds of metrics.
+enum class MetricType : uint8_t {
+    Counter,
+    Gauge,
+    Histogram
+};
+
+// Named value kept for as long as the process runs, rather than only while profiling.
+//
+// Metrics register themselves on construction, and are usually declared as globals, e.g. next to the code they measure.
+// Names should be unique, and have to outlive the metric; string literals are the norm.
+class Metric : public NoCopyObject {
+public:
+    // Returns the name of the metric.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE const char* GetName() const {
+        return this->name;
+    }
+
+    // Returns the kind of the metric.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE MetricType GetType() const {
+        return this->type;
+    }
+
+protected:
+    // Registers the metric.
+    CELL_FUNCTION Metric(const char* CELL_NONNULL name, const MetricType type);
+
+    // Unregisters the metric.
+    CELL_FUNCTION ~Metric();
+
+private:
+    friend class MetricRegistry;
+
+    const char* name;
+    MetricType type;
+
+    Metric* previous = nullptr;
+    Metric* next = nullptr;
+};
+
+// Counts events or amounts, e.g. bytes sent, only ever going up.
+// Every shard is a cache line of its own, so threads counting at once rarely touch the same one.
+class MetricCounter : public Metric {
+public:
+    // Creates and registers a counter at zero.
+    CELL_FUNCTION_TEMPLATE explicit MetricCounter(const char* CELL_NONNULL name) : Metric(name, MetricType::Counter) { }
+
+    // Adds the given amount.
+    CELL_FUNCTION_TEMPLATE void Add(const uint64_t amount = 1) {
+        __atomic_fetch_add(&this->shards[MetricsDetails::GetShard()].value, amount, __ATOMIC_RELAXED);
+    }
+
+    // Returns the sum of all amounts added.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetValue() const;
+
+private:
+    MetricsDetails::CounterShard shards[MetricsDetails::ShardCount] = { };
+};
+
+// Holds the latest value of something, e.g. the number of queued jobs.
+class MetricGauge : public Metric {
+public:
+    // Creates and registers a gauge at zero.
+    CELL_FUNCTION_TEMPLATE explicit MetricGauge(const char* CELL_NONNULL name) : Metric(name, MetricType::Gauge) { }
+
+    // Sets the value.
+    CELL_FUNCTION_TEMPLATE void Set(const double value) {
+        __atomic_store_n(&this->bits, __builtin_bit_cast(uint64_t, value), __ATOMIC_RELAXED);
+    }
+
+    // Adds to the value, which may be negative.
+    CELL_FUNCTION_TEMPLATE void Add(const double amount) {
+        uint64_t expected = __atomic_load_n(&this->bits, __ATOMIC_RELAXED);
+
+        while (!__atomic_compare_exchange_n(&this->bits, &expected, __builtin_bit_cast(uint64_t, __builtin_bit_cast(double, expected) + amount), true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) { }
+    }
+
+    // Returns the value.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE double GetValue() const {
+        return __builtin_bit_cast(double, __atomic_load_n(&this->bits, __ATOMIC_RELAXED));
+    }
+
+private:
+    uint64_t bits = 0;
+};
+
+// Merged state of a histogram at one point in time.
+struct HistogramSnapshot {
+    // Number of recorded values.
+    uint64_t count;
+
+    // Sum, smallest and largest of the recorded values.
+    uint64_t sum;
+    uint64_t minimum;
+    uint64_t maximum;
+
+    // Number of values per bucket.
+    Collection::List<uint64_t> buckets;
+
+    // Returns the value the given percentage of recorded values are at or below, e.g. 99.9, within the histogram's precision.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetPercentile(const double percentile) const;
+
+    // Returns the mean of the recorded values.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE double GetMean() const {
+        return this->count > 0 ? (double)this->sum / (double)this->count : 0.0;
+    }
+};
+
+// Distribution of values, e.g. latencies, covering many orders of magnitude at constant relative precision (HDR histogram).
+//
+// Values below 256 are counted exactly; above, buckets span less than 1% of their value each. Values from 2^40 onwards are counted as
+//  2^40 - 1; in microseconds, that's about 12 days.
+// Every shard holds a full set of buckets, about 35 KiB, which are only allocated once a thread using it records a value.
+class MetricHistogram : public Metric {
+public:
+    // Creates and registers an empty histogram.
+    CELL_FUNCTION_TEMPLATE explicit MetricHistogram(const char* CELL_NONNULL name) : Metric(name, MetricType::Histogram) { }
+
+    // Unregisters the histogram, and frees its shards.
+    CELL_FUNCTION ~MetricHistogram();
+
+    // Records a value.
+    CELL_FUNCTION void Record(const uint64_t value);
+
+    // Merges all shards into a snapshot. Values recorded meanwhile may or may not be part of it.
+    CELL_NODISCARD CELL_FUNCTION HistogramSnapshot Snapshot() const;
+
+    // Discards all recorded values, e.g. to only look at the latest period. Values recorded meanwhile may survive.
+    CELL_FUNCTION void Reset();
+
+private:
+    MetricsDetails::HistogramShard* shards[MetricsDetails::ShardCount] = { };
+};
+
+// Records the time the scope it's alive for takes into a histogram, in microseconds.
+class MetricTimer : public NoCopyObject {
+public:
+    // Starts timing.
+    CELL_FUNCTION_TEMPLATE explicit MetricTimer(MetricHistogram& histogram) : histogram(histogram), start(GetTicks()) { }
+
+    // Records the elapsed time.
+    CELL_FUNCTION_TEMPLATE ~MetricTimer() {
+        this->histogram.Record(TicksToMicroseconds(GetTicks() - this->start));
+    }
+
+private:
+    MetricHistogram& histogram;
+    const uint64_t start;
+};
+
+// Access to all registered metrics.
+class MetricRegistry {
+public:
+    // Returns the metric with the given name, or nullptr if there's none.
+    CELL_NODISCARD CELL_FUNCTION static Metric* CELL_NULLABLE Find(const char* CELL_NONNULL name);
+
+    // Exports the current values of all metrics as text, one per line, e.g. "histogram frame_time_us count=... p50=... p99=...".
+    CELL_NODISCARD CELL_FUNCTION static String ExportText();
+
+    // Exports the current values of all metrics as a JSON object, with counters, gauges and histograms keyed by name.
+    CELL_NODISCARD CELL_FUNCTION static String ExportJSON();
+
+private:
+    friend class Metric;
+
+    CELL_FUNCTION_INTERNAL static void Register(Metric* CELL_NONNULL metric);
+    CELL_FUNCTION_INTERNAL static void Unregister(Metric* CELL_NONNULL metric);
+};
+
+}
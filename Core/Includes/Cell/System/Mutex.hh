@@ -8,22 +8,48 @@
 namespace Cell::System {
 
 // Represents a locking mechanism for resources. Useful to prevent data races.
+//
+// The state is a single word inside the object. Taking a free mutex and releasing one nobody waits for are single atomic operations;
+//  contended threads spin for a short while, and only then sleep on the word as a futex.
 class Mutex : public NoCopyObject {
 public:
     // Creates a new mutex.
-    CELL_FUNCTION Mutex(bool createLocked = false);
+    CELL_FUNCTION_TEMPLATE constexpr Mutex(const bool createLocked = false) : state(createLocked ? Locked : Unlocked) { }
 
     // Releases the mutex.
-    CELL_FUNCTION ~Mutex();
+    CELL_FUNCTION_TEMPLATE constexpr ~Mutex() = default;
 
     // Waits and locks the mutex.
-    CELL_FUNCTION void Lock();
+    CELL_FUNCTION_TEMPLATE void Lock() {
+        uint32_t expected = Unlocked;
+        if (!__atomic_compare_exchange_n(&this->state, &expected, Locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            this->LockContended();
+        }
+    }
+
+    // Locks the mutex if it's free, without waiting. Returns whether it was locked.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool TryLock() {
+        uint32_t expected = Unlocked;
+        return __atomic_compare_exchange_n(&this->state, &expected, Locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    }
 
     // Unlocks the mutex.
-    CELL_FUNCTION void Unlock();
+    CELL_FUNCTION_TEMPLATE void Unlock() {
+        if (__atomic_exchange_n(&this->state, Unlocked, __ATOMIC_RELEASE) == LockedWithWaiters) {
+            this->WakeWaiter();
+        }
+    }
 
 private:
-    uintptr_t impl;
+    // a third state tells the unlocking thread whether anyone might be asleep, so the uncontended case never makes a syscall
+    static constexpr uint32_t Unlocked          = 0;
+    static constexpr uint32_t Locked            = 1;
+    static constexpr uint32_t LockedWithWaiters = 2;
+
+    CELL_FUNCTION void LockContended();
+    CELL_FUNCTION void WakeWaiter();
+
+    uint32_t state;
 };
 
 }
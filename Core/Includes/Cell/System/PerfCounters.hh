@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/String.hh>
+#include <Cell/Wrapped.hh>
+#include <Cell/System/Profiler.hh>
+#include <Cell/System/Result.hh>
+
+namespace Cell::System {
+
+// Hardware and OS events counted by PerfCounters.
+enum class PerfCounter : uint8_t {
+    // Processor cycles spent.
+    Cycles,
+
+    // Instructions retired.
+    Instructions,
+
+    // Accesses missing the last level cache.
+    CacheMisses,
+
+    // Mispredicted branches.
+    BranchMisses,
+
+    // Page faults, minor and major.
+    PageFaults
+};
+
+// Number of events in PerfCounter.
+constexpr size_t PerfCounterCount = 5;
+
+// Counts read from PerfCounters, or the difference between two reads.
+struct PerfSample {
+    // Count of every event, indexed by PerfCounter.
+    uint64_t values[PerfCounterCount];
+
+    // Mask of the events that were counted, with one bit per PerfCounter.
+    uint8_t available;
+
+    // Returns whether the given event was counted.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsAvailable(const PerfCounter counter) const {
+        return (this->available & (1 << (uint8_t)counter)) != 0;
+    }
+
+    // Returns the count of the given event, or zero if it wasn't counted.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t Get(const PerfCounter counter) const {
+        return this->values[(uint8_t)counter];
+    }
+
+    // Returns the number of instructions retired per cycle, or zero if either wasn't counted.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE double GetInstructionsPerCycle() const {
+        if (!this->IsAvailable(PerfCounter::Cycles) || !this->IsAvailable(PerfCounter::Instructions) || this->Get(PerfCounter::Cycles) == 0) {
+            return 0.0;
+        }
+
+        return (double)this->Get(PerfCounter::Instructions) / (double)this->Get(PerfCounter::Cycles);
+    }
+
+    // Returns the count of the given event per processed element, e.g. cache misses per element of an array.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE double GetPerElement(const PerfCounter counter, const uint64_t elements) const {
+        return elements > 0 ? (double)this->Get(counter) / (double)elements : 0.0;
+    }
+
+    // Returns the counts since the given earlier sample.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE PerfSample operator - (const PerfSample& earlier) const {
+        PerfSample difference = { .values = { 0 }, .available = (uint8_t)(this->available & earlier.available) };
+
+        for (size_t i = 0; i < PerfCounterCount; i++) {
+            difference.values[i] = this->values[i] - earlier.values[i];
+        }
+
+        return difference;
+    }
+
+    // Summarizes the counts for a run over the given number of elements, e.g. "1.84 IPC, 0.02 cache misses/element, ...".
+    CELL_NODISCARD CELL_FUNCTION String ToString(const uint64_t elements = 1) const;
+};
+
+// Reads hardware performance counters for the calling thread, to tell why a piece of code is slow, not only that it is.
+//
+// All events are counted as one group, so every read is a consistent snapshot of them; counting starts once opened, and the
+//  difference between two reads covers the code in between. Only user space is counted.
+// Events the processor or OS doesn't offer, e.g. hardware events within virtual machines, are left out.
+// Only supported on Linux, through perf_event_open.
+class PerfCounters : public NoCopyObject {
+public:
+    // Opens the counters for the calling thread.
+    // Fails with AccessDenied if the system doesn't permit counting (see perf_event_paranoid), and Unsupported if no event is available.
+    CELL_NODISCARD CELL_FUNCTION static Wrapped<PerfCounters*, Result> Open();
+
+    // Closes the counters.
+    CELL_FUNCTION ~PerfCounters();
+
+    // Reads all counts as of now.
+    CELL_NODISCARD CELL_FUNCTION PerfSample Read() const;
+
+    // Returns whether the given event is counted.
+    CELL_NODISCARD CELL_FUNCTION bool IsAvailable(const PerfCounter counter) const;
+
+private:
+    CELL_FUNCTION_INTERNAL PerfCounters(uintptr_t i) : impl(i) { }
+
+    uintptr_t impl;
+};
+
+// Measures the counters over the scope it's alive for.
+//
+// If the profiler is capturing, instructions per cycle and misses per element are recorded as counters under the given name.
+class PerfScope : public NoCopyObject {
+public:
+    // Starts measuring. The result, if given, receives the counts once the scope ends.
+    CELL_FUNCTION_TEMPLATE PerfScope(const PerfCounters& counters, const char* CELL_NONNULL name, const uint64_t elements = 1,
+                                     PerfSample* CELL_NULLABLE result = nullptr)
+        : counters(counters), name(name), elements(elements), result(result), start(counters.Read()) { }
+
+    // Stops measuring, and reports the counts.
+    CELL_FUNCTION_TEMPLATE ~PerfScope() {
+        const PerfSample sample = this->counters.Read() - this->start;
+
+        if (this->result != nullptr) {
+            *this->result = sample;
+        }
+
+        if (sample.IsAvailable(PerfCounter::Instructions) && sample.IsAvailable(PerfCounter::Cycles)) {
+            CELL_PROFILE_COUNTER(this->name, "instructions per cycle", sample.GetInstructionsPerCycle());
+        }
+
+        if (sample.IsAvailable(PerfCounter::CacheMisses)) {
+            CELL_PROFILE_COUNTER(this->name, "cache misses per element", sample.GetPerElement(PerfCounter::CacheMisses, this->elements));
+        }
+
+        if (sample.IsAvailable(PerfCounter::BranchMisses)) {
+            CELL_PROFILE_COUNTER(this->name, "branch misses per element", sample.GetPerElement(PerfCounter::BranchMisses, this->elements));
+        }
+    }
+
+private:
+    const PerfCounters& counters;
+    const char* name;
+    const uint64_t elements;
+    PerfSample* result;
+
+    const PerfSample start;
+};
+
+}
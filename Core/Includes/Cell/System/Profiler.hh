@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Collection/List.hh>
+#include <Cell/IO/Result.hh>
+#include <Cell/Utilities/Preprocessor.hh>
+#include <Cell/String.hh>
+
+namespace Cell::System {
+
+class Profiler;
+
+namespace ProfilerDetails {
+struct Buffer;
+
+// Records the beginning of a scope with the active profiler, if it's capturing.
+// Returns a token for ending the scope, or zero if nothing was recorded.
+CELL_NODISCARD CELL_FUNCTION uint64_t Begin(const char* CELL_NONNULL name);
+
+// Records the end of the scope begun with the given token, as long as it's still part of the same capture.
+CELL_FUNCTION void End(const uint64_t token);
+
+// Records a value of the series with the given key, in the counter of the given name, with the active profiler, if it's capturing.
+CELL_FUNCTION void Counter(const char* CELL_NONNULL name, const char* CELL_NONNULL key, const double value);
+}
+
+// Formats captures can be exported to.
+enum class TraceFormat : uint8_t {
+    // JSON trace event format, as loaded by chrome://tracing and Perfetto.
+    Chrome,
+
+    // Perfetto's protobuf trace format.
+    Perfetto
+};
+
+// Profiles the scope it's alive for, if the active profiler is capturing.
+class ProfileScope : public NoCopyObject {
+public:
+    // Records the beginning of the scope. The name has to outlive the capture; string literals are the norm.
+    CELL_FUNCTION_TEMPLATE explicit ProfileScope(const char* CELL_NONNULL name) : token(ProfilerDetails::Begin(name)) { }
+
+    // Records the end of the scope.
+    CELL_FUNCTION_TEMPLATE ~ProfileScope() {
+        if (this->token != 0) {
+            ProfilerDetails::End(this->token);
+        }
+    }
+
+private:
+    const uint64_t token;
+};
+
+// Records where time goes across threads, as nested scopes.
+//
+// Every thread entering a scope gets a buffer of its own, which only that thread writes to, without locking. Scopes only store their name
+//  and a tick count; everything else is left for exporting, which is meant to happen once the capture is stopped.
+// Scopes that don't fit into a full buffer are dropped whole, so every recorded beginning has room for its end.
+// Counters are recorded alongside scopes, per thread, with every value taking up the room of two events.
+// Only one profiler can exist at a time.
+class Profiler : public NoCopyObject {
+public:
+    // Creates a stopped profiler. Every thread entering a scope gets room for the given number of beginnings and ends.
+    CELL_FUNCTION explicit Profiler(const size_t eventsPerThread = 64 * 1024);
+
+    // Destructs the profiler.
+    // Other threads must have left their scopes before, and buffers are only freed here, so they outlive the threads they belong to.
+    CELL_FUNCTION ~Profiler();
+
+    // Starts a new capture, discarding the previous one.
+    CELL_FUNCTION void Start();
+
+    // Stops capturing. Scopes entered before still record their end.
+    CELL_FUNCTION void Stop();
+
+    // Returns whether a capture is running.
+    CELL_NODISCARD CELL_FUNCTION bool IsCapturing() const;
+
+    // Returns the number of scopes dropped due to full buffers during the last capture.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetDroppedCount() const;
+
+    // Exports the last capture in the given format.
+    CELL_NODISCARD CELL_FUNCTION Collection::List<uint8_t> Export(const TraceFormat format) const;
+
+    // Exports the last capture in the given format, and writes it to the file at the given path.
+    CELL_FUNCTION IO::Result Save(const String& path, const TraceFormat format) const;
+
+private:
+    friend uint64_t ProfilerDetails::Begin(const char*);
+    friend void ProfilerDetails::End(const uint64_t);
+    friend void ProfilerDetails::Counter(const char*, const char*, const double);
+
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL ProfilerDetails::Buffer* GetBuffer(const uint64_t capture);
+
+    CELL_FUNCTION_INTERNAL void ExportChrome(Collection::List<uint8_t>& output) const;
+    CELL_FUNCTION_INTERNAL void ExportPerfetto(Collection::List<uint8_t>& output) const;
+
+    size_t eventsPerThread;
+    uint64_t generation;
+
+    // capture in progress, zero while stopped, and the last one started
+    uint64_t capture = 0;
+    uint64_t lastCapture = 0;
+    uint64_t startTicks = 0;
+
+    // buffers of all threads that have entered a scope, pushed as a stack
+    ProfilerDetails::Buffer* buffers = nullptr;
+};
+
+}
+
+#ifdef CELL_CORE_PROFILER
+
+// Profiles the current scope under the given name. Scopes can be declared after one another within the same block.
+#define CELL_PROFILE_SCOPE(name) const Cell::System::ProfileScope CELL_CONCATENATE(_cellProfileScope, __LINE__)(name)
+
+// Profiles the current function.
+#define CELL_PROFILE_FUNCTION() CELL_PROFILE_SCOPE(__func__)
+
+// Records a value of a counter series, e.g. CELL_PROFILE_COUNTER("Renderer", "draw calls", count).
+#define CELL_PROFILE_COUNTER(name, key, value) Cell::System::ProfilerDetails::Counter(name, key, (double)(value))
+
+#else
+
+#define CELL_PROFILE_SCOPE(name)
+#define CELL_PROFILE_FUNCTION()
+#define CELL_PROFILE_COUNTER(name, key, value)
+
+#endif
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::System {
+
+// Lock allowing either any number of readers, or a single writer.
+//
+// A waiting writer keeps new readers out, so a steady stream of readers can't starve it.
+// Taking and releasing an uncontended lock are single atomic operations; contended threads spin for a short while before sleeping.
+class RWLock : public NoCopyObject {
+public:
+    // Creates a new, unlocked reader-writer lock.
+    CELL_FUNCTION_TEMPLATE constexpr RWLock() = default;
+
+    // Releases the lock.
+    CELL_FUNCTION_TEMPLATE constexpr ~RWLock() = default;
+
+    // Waits and locks for shared, reading access.
+    CELL_FUNCTION_TEMPLATE void LockShared() {
+        uint32_t state = __atomic_load_n(&this->state, __ATOMIC_RELAXED);
+        if ((state & (Writing | WriterWaiting)) != 0 || !__atomic_compare_exchange_n(&this->state, &state, state + 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            this->LockSharedContended();
+        }
+    }
+
+    // Releases shared access.
+    CELL_FUNCTION_TEMPLATE void UnlockShared() {
+        // the last reader out lets a waiting writer in
+        const uint32_t state = __atomic_sub_fetch(&this->state, 1, __ATOMIC_SEQ_CST);
+        if ((state & ReaderMask) == 0 && __atomic_load_n(&this->waiters, __ATOMIC_SEQ_CST) > 0) {
+            this->WakeWaiters();
+        }
+    }
+
+    // Waits and locks for exclusive, writing access.
+    CELL_FUNCTION_TEMPLATE void Lock() {
+        uint32_t expected = 0;
+        if (!__atomic_compare_exchange_n(&this->state, &expected, Writing, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            this->LockContended();
+        }
+    }
+
+    // Releases exclusive access.
+    CELL_FUNCTION_TEMPLATE void Unlock() {
+        __atomic_store_n(&this->state, 0, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&this->waiters, __ATOMIC_SEQ_CST) > 0) {
+            this->WakeWaiters();
+        }
+    }
+
+private:
+    // the low bits count the readers
+    static constexpr uint32_t Writing       = 1u << 31;
+    static constexpr uint32_t WriterWaiting = 1u << 30;
+    static constexpr uint32_t ReaderMask    = WriterWaiting - 1;
+
+    CELL_FUNCTION void LockSharedContended();
+    CELL_FUNCTION void LockContended();
+    CELL_FUNCTION void WakeWaiters();
+
+    uint32_t state = 0;
+    uint32_t waiters = 0;
+};
+
+}
@@ -34,7 +34,10 @@ enum class Result : uint8_t {
     OutOfMemory,
 
     // A resource was inaccessible.
-    AccessDenied
+    AccessDenied,
+
+    // The operation isn't supported on this platform.
+    Unsupported
 };
 
 }
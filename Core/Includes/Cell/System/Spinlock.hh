@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Thread.hh>
+
+namespace Cell::System {
+
+// Lock that never sleeps, for critical sections only a few instructions long.
+//
+// Waiting threads spin on a plain load, so they don't keep the cache line bouncing between cores, and yield to the scheduler
+//  now and then in case the holder got preempted. Anything longer should use a Mutex.
+class Spinlock : public NoCopyObject {
+public:
+    // Creates a new, unlocked spinlock.
+    CELL_FUNCTION_TEMPLATE constexpr Spinlock() = default;
+
+    // Releases the spinlock.
+    CELL_FUNCTION_TEMPLATE constexpr ~Spinlock() = default;
+
+    // Waits and locks the spinlock.
+    CELL_FUNCTION_TEMPLATE void Lock() {
+        uint32_t spins = 0;
+
+        while (__atomic_exchange_n(&this->locked, 1, __ATOMIC_ACQUIRE) != 0) {
+            while (__atomic_load_n(&this->locked, __ATOMIC_RELAXED) != 0) {
+                if (++spins % YieldInterval == 0) {
+                    Thread::Yield();
+                } else {
+                    CpuRelax();
+                }
+            }
+        }
+    }
+
+    // Locks the spinlock if it's free, without waiting. Returns whether it was locked.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool TryLock() {
+        return __atomic_load_n(&this->locked, __ATOMIC_RELAXED) == 0 && __atomic_exchange_n(&this->locked, 1, __ATOMIC_ACQUIRE) == 0;
+    }
+
+    // Unlocks the spinlock.
+    CELL_FUNCTION_TEMPLATE void Unlock() {
+        __atomic_store_n(&this->locked, 0, __ATOMIC_RELEASE);
+    }
+
+private:
+    // number of spins between yields
+    static constexpr uint32_t YieldInterval = 1024;
+
+    uint32_t locked = 0;
+};
+
+}
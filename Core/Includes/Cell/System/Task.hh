@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Construct.hh>
+#include <Cell/System/JobSystem.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/Utilities/Move.hh>
+
+#include <coroutine>
+
+namespace Cell::System {
+
+template <typename T = void> class Task;
+
+namespace TaskDetails {
+
+// Job function resuming the coroutine at the given address.
+CELL_FUNCTION_TEMPLATE void ResumeJob(void* address) {
+    std::coroutine_handle<>::from_address(address).resume();
+}
+
+struct PromiseBase {
+    // coroutine awaiting this one, continued once it finishes
+    std::coroutine_handle<> continuation = nullptr;
+
+    // counter for tasks started on a job system, finished once the coroutine is done
+    JobSystem* jobs = nullptr;
+    JobCounter* counter = nullptr;
+
+    struct FinalAwaiter {
+        CELL_FUNCTION_TEMPLATE bool await_ready() noexcept {
+            return false;
+        }
+
+        template <typename P> CELL_FUNCTION_TEMPLATE std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+            PromiseBase& promise = handle.promise();
+            if (promise.continuation) {
+                return promise.continuation;
+            }
+
+            // the frame may be destroyed as soon as the counter reaches zero, so nothing's touched afterwards
+            if (promise.counter != nullptr) {
+                promise.jobs->Finish(*promise.counter);
+            }
+
+            return std::noop_coroutine();
+        }
+
+        CELL_FUNCTION_TEMPLATE void await_resume() noexcept { }
+    };
+
+    CELL_FUNCTION_TEMPLATE static void* operator new(size_t size) {
+        return Memory::AllocateUninitialized(size);
+    }
+
+    CELL_FUNCTION_TEMPLATE static void operator delete(void* memory, size_t size) {
+        (void)(size);
+
+        Memory::Free(memory);
+    }
+
+    CELL_FUNCTION_TEMPLATE std::suspend_always initial_suspend() noexcept {
+        return { };
+    }
+
+    CELL_FUNCTION_TEMPLATE FinalAwaiter final_suspend() noexcept {
+        return { };
+    }
+
+    CELL_FUNCTION_TEMPLATE void unhandled_exception() {
+        System::Panic("Unhandled exception in a task");
+    }
+};
+
+template <typename T> struct Promise : public PromiseBase {
+    alignas(T) uint8_t storage[sizeof(T)];
+    bool hasResult = false;
+
+    CELL_FUNCTION_TEMPLATE ~Promise() {
+        if (this->hasResult) {
+            Memory::Destruct<T>((T*)this->storage);
+        }
+    }
+
+    CELL_FUNCTION_TEMPLATE Task<T> get_return_object();
+
+    CELL_FUNCTION_TEMPLATE void return_value(const T& value) {
+        Memory::Construct<T>((T*)this->storage, value);
+        this->hasResult = true;
+    }
+
+    CELL_FUNCTION_TEMPLATE void return_value(T&& value) {
+        Memory::Construct<T>((T*)this->storage, Utilities::Move(value));
+        this->hasResult = true;
+    }
+
+    CELL_FUNCTION_TEMPLATE T TakeResult() {
+        CELL_ASSERT(this->hasResult);
+
+        return Utilities::Move(*(T*)this->storage);
+    }
+};
+
+template <> struct Promise<void> : public PromiseBase {
+    CELL_FUNCTION_TEMPLATE Task<void> get_return_object();
+
+    CELL_FUNCTION_TEMPLATE void return_void() { }
+
+    CELL_FUNCTION_TEMPLATE void TakeResult() { }
+};
+
+}
+
+// Coroutine producing a result of type T.
+//
+// Tasks start suspended; the coroutine only runs once the task is awaited by another coroutine, or started on a job system.
+// Awaiting a task continues the awaiting coroutine on whichever thread the task finished on, without going through the job system.
+// The task owns the coroutine, and has to outlive its execution.
+template <typename T> class Task : public NoCopyObject {
+public:
+    using promise_type = TaskDetails::Promise<T>;
+
+    // Creates a task for the given coroutine. Used by the compiler.
+    CELL_FUNCTION_TEMPLATE explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) { }
+
+    // Takes over the coroutine of another task.
+    CELL_FUNCTION_TEMPLATE Task(Task&& other) : handle(other.handle) {
+        other.handle = nullptr;
+    }
+
+    // Destroys the coroutine.
+    CELL_FUNCTION_TEMPLATE ~Task() {
+        if (this->handle) {
+            this->handle.destroy();
+        }
+    }
+
+    // Starts running the coroutine as a job. The counter, if given, reaches zero once the coroutine has finished.
+    CELL_FUNCTION_TEMPLATE void Start(JobSystem& jobs, JobCounter* CELL_NULLABLE counter = nullptr) {
+        CELL_ASSERT(this->handle && !this->handle.done());
+
+        promise_type& promise = this->handle.promise();
+        promise.jobs = &jobs;
+        promise.counter = counter;
+
+        if (counter != nullptr) {
+            jobs.Track(*counter);
+        }
+
+        jobs.Run(TaskDetails::ResumeJob, this->handle.address());
+    }
+
+    // Starts running the coroutine, runs jobs on the calling thread until it has finished, and returns its result.
+    CELL_FUNCTION_TEMPLATE T Wait(JobSystem& jobs) {
+        JobCounter counter;
+
+        this->Start(jobs, &counter);
+        jobs.Wait(counter);
+
+        return this->handle.promise().TakeResult();
+    }
+
+    // Checks whether the coroutine has finished.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE bool IsDone() const {
+        return this->handle && this->handle.done();
+    }
+
+    // Returns the result of the finished coroutine, moving it out of the task.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE T GetResult() {
+        CELL_ASSERT(this->IsDone());
+
+        return this->handle.promise().TakeResult();
+    }
+
+    // Awaiting a task always suspends the awaiting coroutine; used by the compiler.
+    CELL_FUNCTION_TEMPLATE bool await_ready() const noexcept {
+        return false;
+    }
+
+    // Runs the coroutine in place of the awaiting one, which is continued once it has finished; used by the compiler.
+    CELL_FUNCTION_TEMPLATE std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        this->handle.promise().continuation = awaiting;
+        return this->handle;
+    }
+
+    // Returns the result of the coroutine to the awaiting one; used by the compiler.
+    CELL_FUNCTION_TEMPLATE T await_resume() {
+        return this->handle.promise().TakeResult();
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+template <typename T> CELL_FUNCTION_TEMPLATE Task<T> TaskDetails::Promise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+CELL_FUNCTION_TEMPLATE Task<void> TaskDetails::Promise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/IO/File.hh>
+#include <Cell/Network/Socket.hh>
+#include <Cell/System/Event.hh>
+#include <Cell/System/Task.hh>
+#include <Cell/System/Thread.hh>
+#include <Cell/Utilities/Concepts.hh>
+
+namespace Cell::System {
+
+// Prototype definition for a function checking whether a condition holds, without blocking.
+typedef bool (* TaskPollFunction)(void* CELL_NULLABLE parameter);
+
+class TaskScheduler;
+
+namespace TaskDetails {
+
+template <typename T> struct ResultStorage {
+    alignas(T) uint8_t data[sizeof(T)];
+};
+
+template <> struct ResultStorage<void> { };
+
+}
+
+// Suspends a coroutine until a condition holds, or a deadline has passed, and then continues it on the job system.
+class TaskAwaiter : public Object {
+public:
+    // Checks whether the coroutine can continue right away; used by the compiler.
+    CELL_FUNCTION bool await_ready();
+
+    // Hands the coroutine to the scheduler; used by the compiler.
+    CELL_FUNCTION void await_suspend(std::coroutine_handle<> handle);
+
+    // Does nothing, as there's no result; used by the compiler.
+    CELL_FUNCTION_TEMPLATE void await_resume() { }
+
+private:
+    friend class TaskScheduler;
+
+    CELL_FUNCTION_INTERNAL TaskAwaiter(TaskScheduler* s, TaskPollFunction f, void* p, uint64_t d) : scheduler(s), poll(f), parameter(p), deadline(d) { }
+
+    CELL_NODISCARD CELL_FUNCTION_INTERNAL bool IsReady(const uint64_t now) const;
+
+    TaskScheduler* scheduler;
+    TaskPollFunction poll;
+    void* parameter;
+    uint64_t deadline;
+
+    std::coroutine_handle<> handle = nullptr;
+    TaskAwaiter* next = nullptr;
+};
+
+// Runs blocking work as a job while the awaiting coroutine is suspended, and continues it with the result on the same worker.
+template <typename F> class TaskOffloadAwaiter : public Object {
+    using R = decltype((*(F*)nullptr)());
+
+public:
+    template <typename G> CELL_FUNCTION_TEMPLATE TaskOffloadAwaiter(JobSystem& jobs, G&& function) : jobs(jobs), function(Utilities::Forward<G>(function)) { }
+
+    CELL_FUNCTION_TEMPLATE ~TaskOffloadAwaiter() {
+        if constexpr (!Utilities::IsSame<R, void>) {
+            if (this->hasResult) {
+                Memory::Destruct<R>((R*)this->result.data);
+            }
+        }
+    }
+
+    // Blocking work is never done in place; used by the compiler.
+    CELL_FUNCTION_TEMPLATE bool await_ready() const {
+        return false;
+    }
+
+    // Queues the work as a job; used by the compiler.
+    CELL_FUNCTION_TEMPLATE void await_suspend(std::coroutine_handle<> handle) {
+        this->handle = handle;
+
+        this->jobs.Run([](void* parameter) {
+            TaskOffloadAwaiter* awaiter = (TaskOffloadAwaiter*)parameter;
+
+            if constexpr (Utilities::IsSame<R, void>) {
+                awaiter->function();
+            } else {
+                Memory::Construct<R>((R*)awaiter->result.data, awaiter->function());
+                awaiter->hasResult = true;
+            }
+
+            awaiter->handle.resume();
+        }, this);
+    }
+
+    // Returns the result of the work; used by the compiler.
+    CELL_FUNCTION_TEMPLATE R await_resume() {
+        if constexpr (!Utilities::IsSame<R, void>) {
+            return Utilities::Move(*(R*)this->result.data);
+        }
+    }
+
+private:
+    JobSystem& jobs;
+    F function;
+
+    std::coroutine_handle<> handle = nullptr;
+
+    TaskDetails::ResultStorage<R> result;
+    bool hasResult = false;
+};
+
+// Continues suspended coroutines on a job system once what they're waiting for is ready.
+//
+// Timers, events and anything else that can be checked without blocking are polled from a single thread, which queues ready coroutines
+//  as jobs. Any number of coroutines can wait at once, without holding a thread each.
+// Work without such a check, like file reads, is run as a job instead, with the coroutine suspended meanwhile.
+class TaskScheduler : public NoCopyObject {
+public:
+    // Starts the polling thread, continuing coroutines on the given job system.
+    CELL_FUNCTION explicit TaskScheduler(JobSystem& jobs);
+
+    // Stops the polling thread. No coroutine may be waiting through the scheduler anymore.
+    CELL_FUNCTION ~TaskScheduler();
+
+    // Returns the job system coroutines are continued on.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE JobSystem& GetJobSystem() {
+        return this->jobs;
+    }
+
+    // Continues the awaiting coroutine as a job, e.g. to move it off the thread that started it.
+    CELL_NODISCARD CELL_FUNCTION TaskAwaiter Schedule();
+
+    // Continues the awaiting coroutine once the given number of microseconds has passed.
+    CELL_NODISCARD CELL_FUNCTION TaskAwaiter Delay(const uint64_t microseconds);
+
+    // Continues the awaiting coroutine once the event is signaled.
+    CELL_NODISCARD CELL_FUNCTION TaskAwaiter WaitFor(Event& event);
+
+    // Continues the awaiting coroutine once the poll function returns true. It's called from the polling thread, and must not block.
+    CELL_NODISCARD CELL_FUNCTION TaskAwaiter WaitUntil(TaskPollFunction CELL_NONNULL poll, void* CELL_NULLABLE parameter = nullptr);
+
+    // Runs the given function as a job, and continues the awaiting coroutine with its result.
+    template <typename F> CELL_NODISCARD CELL_FUNCTION_TEMPLATE auto Offload(F&& function) {
+        return TaskOffloadAwaiter<typename Utilities::RemoveReferenceType<F>::Type>(this->jobs, Utilities::Forward<F>(function));
+    }
+
+    // Reads from the file into the given block at the given offset, continuing the awaiting coroutine with the result.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE auto Read(IO::File& file, Memory::IBlock& data, const size_t offset) {
+        return this->Offload([&file, &data, offset] { return file.Read(data, offset); });
+    }
+
+    // Receives from the socket into the given block, continuing the awaiting coroutine with the result.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE auto Receive(Network::Socket& socket, Memory::IBlock& data) {
+        return this->Offload([&socket, &data] { return socket.Receive(data); });
+    }
+
+private:
+    friend class TaskAwaiter;
+
+    CELL_FUNCTION_INTERNAL void Enqueue(TaskAwaiter* CELL_NONNULL awaiter);
+    CELL_FUNCTION_INTERNAL void RunPoller();
+
+    JobSystem& jobs;
+
+    Thread* poller;
+    Event wake;
+
+    // awaiters handed over since the poller last looked, pushed as a stack
+    TaskAwaiter* incoming = nullptr;
+    bool running = true;
+};
+
+}
@@ -17,6 +17,25 @@ namespace Cell::System {
 // Prototype definition for a thread function.
 typedef void (* ThreadFunction)(void* CELL_NULLABLE parameter);
 
+// Scheduling priority classes for threads.
+enum class ThreadPriority : uint8_t {
+    // Only runs when nothing else wants the processor, e.g. for background loading.
+    Idle,
+
+    // Runs behind regular threads.
+    Low,
+
+    // The default for new threads.
+    Normal,
+
+    // Runs ahead of regular threads, e.g. for rendering.
+    High,
+
+    // Fixed priority scheduling ahead of all regular threads, for latency critical work like audio.
+    // Usually requires elevated privileges; setting it fails with AccessDenied otherwise.
+    RealTime
+};
+
 // Represents a thread from the OS.
 class Thread : public NoCopyObject {
 public:
@@ -38,9 +57,31 @@ public:
     // Sets the name of this thread, if possible.
     CELL_FUNCTION Result SetName(const String& name);
 
+    // Sets the scheduling priority class of this thread.
+    // Returns AccessDenied if the process isn't privileged enough, e.g. for raising the priority back up after having been niced.
+    CELL_FUNCTION Result SetPriority(const ThreadPriority priority);
+
+    // Restricts this thread to the logical processors set in the mask, e.g. as given by ProcessorTopology.
+    // Returns Unsupported on platforms that only take affinity hints.
+    CELL_FUNCTION Result SetAffinity(const uint64_t mask);
+
+    // Sets the scheduling priority class of the calling thread.
+    // Returns AccessDenied if the process isn't privileged enough.
+    CELL_FUNCTION static Result SetCurrentPriority(const ThreadPriority priority);
+
+    // Restricts the calling thread to the logical processors set in the mask.
+    // Returns Unsupported on platforms that only take affinity hints.
+    CELL_FUNCTION static Result SetCurrentAffinity(const uint64_t mask);
+
     // Requests the scheduler to yield execution.
     CELL_FUNCTION static void Yield();
 
+    // Returns the number of logical processors currently available to the process.
+    CELL_NODISCARD CELL_FUNCTION static uint32_t GetProcessorCount();
+
+    // Returns the identifier the OS knows the calling thread by.
+    CELL_NODISCARD CELL_FUNCTION static uint64_t GetCurrentId();
+
 private:
     uintptr_t impl;
 };
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::System {
+
+namespace TicksDetails {
+
+// Multiplies a by the 32.32 fixed point number b, truncating the result to 64 bits.
+// Built from 32-bit halves, so it doesn't rely on 128-bit integers; the result is exact modulo 2^64.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr uint64_t MultiplyFixed32(const uint64_t a, const uint64_t b) {
+    const uint64_t aLow = a & 0xffffffff, aHigh = a >> 32;
+    const uint64_t bLow = b & 0xffffffff, bHigh = b >> 32;
+
+    return ((aHigh * bHigh) << 32) + aHigh * bLow + aLow * bHigh + ((aLow * bLow) >> 32);
+}
+
+}
+
+// Conversion between ticks and time, measured once per process.
+struct TickCalibration {
+    // Number of ticks per second.
+    uint64_t frequency;
+
+    // Nanoseconds per tick, as a 32.32 fixed point number.
+    uint64_t nanosecondScale;
+
+    // Whether ticks come from the processor's counter, rather than the monotonic clock.
+    bool hardware;
+
+    // Converts a number of ticks to nanoseconds.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t ToNanoseconds(const uint64_t ticks) const {
+        return TicksDetails::MultiplyFixed32(ticks, this->nanosecondScale);
+    }
+
+    // Converts a number of ticks to microseconds.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t ToMicroseconds(const uint64_t ticks) const {
+        return this->ToNanoseconds(ticks) / 1000;
+    }
+
+    // Converts nanoseconds to a number of ticks.
+    CELL_NODISCARD CELL_FUNCTION uint64_t FromNanoseconds(const uint64_t nanoseconds) const;
+
+    // Converts microseconds to a number of ticks.
+    CELL_NODISCARD CELL_FUNCTION uint64_t FromMicroseconds(const uint64_t microseconds) const;
+};
+
+// Reads the tick counter, for timing hot paths.
+//
+// Ticks come straight from the processor, i.e. the time stamp counter on x86, if it runs at a constant rate, or the virtual counter on ARM.
+// Otherwise, the monotonic clock is read in nanoseconds instead. Either way, ticks only go forward, and are comparable across threads.
+// They're only meaningful relative to each other; GetTickCalibration converts them to time.
+CELL_NODISCARD CELL_FUNCTION uint64_t GetTicks();
+
+// Returns the calibration of ticks against the monotonic clock. The first call measures it, taking about 10 milliseconds.
+CELL_NODISCARD CELL_FUNCTION const TickCalibration& GetTickCalibration();
+
+// Converts a number of ticks to nanoseconds.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t TicksToNanoseconds(const uint64_t ticks) {
+    return GetTickCalibration().ToNanoseconds(ticks);
+}
+
+// Converts a number of ticks to microseconds.
+CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint64_t TicksToMicroseconds(const uint64_t ticks) {
+    return GetTickCalibration().ToMicroseconds(ticks);
+}
+
+}
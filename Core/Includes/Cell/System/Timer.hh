@@ -10,10 +10,18 @@ namespace Cell::System {
 // Returns a precise timer value with microseconds accuracy (at least 100 ns).
 CELL_FUNCTION uint64_t GetPreciseTickerValue();
 
+// Returns the value of the same timer in nanoseconds.
+CELL_FUNCTION uint64_t GetPreciseTickerNanoseconds();
+
 // Sleeps for the given amount of milliseconds.
 CELL_FUNCTION void Sleep(const uint32_t milliseconds);
 
 // Sleeps for the given amount of microseconds.
 CELL_FUNCTION void SleepPrecise(const uint64_t microseconds);
 
+// Sleeps until the precise timer reaches the given value, in microseconds.
+// The deadline is absolute, so time lost to scheduling doesn't add up across repeated sleeps. Wakes up late by however long
+//  the scheduler takes; see FramePacer for waking up close to the deadline.
+CELL_FUNCTION void SleepUntil(const uint64_t deadline);
+
 }
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Wrapped.hh>
+#include <Cell/Collection/List.hh>
+#include <Cell/Collection/Span.hh>
+#include <Cell/System/Result.hh>
+
+namespace Cell::System {
+
+// Describes a logical processor.
+struct LogicalProcessor {
+    // Index of the processor, as used by affinity masks.
+    uint32_t index;
+
+    // Physical core the processor belongs to; processors sharing a core are SMT siblings.
+    uint32_t core;
+
+    // Group of cores sharing the last level cache.
+    uint32_t cacheGroup;
+
+    // Physical package (socket) the processor belongs to.
+    uint32_t package;
+};
+
+// Layout of the logical processors available to the process, for placing threads deliberately.
+//
+// Core, cache group and package numbers are dense, starting at zero.
+// Affinity masks only cover the first 64 logical processors; any beyond are left out of the topology.
+class ProcessorTopology : public NoCopyObject {
+public:
+    // Queries the processor topology of the system.
+    CELL_FUNCTION static Wrapped<ProcessorTopology*, Result> Query();
+
+    // Destructs the topology.
+    CELL_FUNCTION_TEMPLATE ~ProcessorTopology() = default;
+
+    // Returns all logical processors, ordered by index.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE Collection::Span<const LogicalProcessor> GetProcessors() const {
+        return Collection::Span<const LogicalProcessor>(this->processors.begin(), this->processors.GetCount());
+    }
+
+    // Returns the number of physical cores.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint32_t GetCoreCount() const {
+        return this->coreCount;
+    }
+
+    // Returns the number of groups of cores sharing a last level cache.
+    CELL_NODISCARD CELL_FUNCTION_TEMPLATE uint32_t GetCacheGroupCount() const {
+        return this->cacheGroupCount;
+    }
+
+    // Returns the affinity mask of the logical processors of the given core.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetCoreMask(const uint32_t core) const;
+
+    // Returns the affinity mask of the logical processors sharing the given last level cache.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetCacheGroupMask(const uint32_t cacheGroup) const;
+
+    // Returns the affinity mask with the first logical processor of each core, leaving out SMT siblings.
+    CELL_NODISCARD CELL_FUNCTION uint64_t GetPrimaryMask() const;
+
+private:
+    // Takes over processors with arbitrary core, cache group and package numbers, and renumbers them densely.
+    CELL_FUNCTION_INTERNAL explicit ProcessorTopology(Collection::List<LogicalProcessor>& processors);
+
+    Collection::List<LogicalProcessor> processors;
+
+    uint32_t coreCount = 0;
+    uint32_t cacheGroupCount = 0;
+};
+
+}
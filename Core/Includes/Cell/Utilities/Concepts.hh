@@ -18,6 +18,10 @@ template <CompleteType T> constexpr bool IsPointerType<T*> = true;
 template <typename T> constexpr bool ImplementsCellObject = __is_base_of(Object, T);
 template <CompleteType T> constexpr bool ImplementsCellObject<T*> = __is_base_of(Object, T);
 
+template <typename T> constexpr bool IsTriviallyCopyable = __is_trivially_copyable(T);
+
+template <typename T, typename U> constexpr bool IsSame = __is_same(T, U);
+
 template <ClassType T> constexpr bool IsDeletable = IsPointerType<T> && ImplementsCellObject<T>;
 
 }
@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#pragma once
+
+#include <Cell/Cell.hh>
+
+namespace Cell::Utilities {
+
+template <typename T> struct RemoveReferenceType { using Type = T; };
+template <typename T> struct RemoveReferenceType<T&> { using Type = T; };
+template <typename T> struct RemoveReferenceType<T&&> { using Type = T; };
+
+// Strips references from the given type.
+template <typename T> using RemoveReference = typename RemoveReferenceType<T>::Type;
+
+// Marks the given value as movable, allowing its resources to be taken over.
+template <typename T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr RemoveReference<T>&& Move(T&& value) {
+    return (RemoveReference<T>&&)value;
+}
+
+// Passes on a forwarding reference with its original value category.
+template <typename T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr T&& Forward(RemoveReference<T>& value) {
+    return (T&&)value;
+}
+
+// Passes on a forwarding reference with its original value category.
+template <typename T> CELL_NODISCARD CELL_FUNCTION_TEMPLATE constexpr T&& Forward(RemoveReference<T>&& value) {
+    return (T&&)value;
+}
+
+}
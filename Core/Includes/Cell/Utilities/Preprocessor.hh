@@ -17,6 +17,10 @@
     CELL_FUNCTION_TEMPLATE constexpr N operator&(const N a, const N b) { return (N)((CELL_BASE_TYPE(N))a & (CELL_BASE_TYPE(N))b); } \
     CELL_FUNCTION_TEMPLATE constexpr N& operator&=(N& a, const N b) { a = a & b; return a; }
 
+// Pastes two tokens together, after expanding them, e.g. to give variables declared by macros unique names with __LINE__.
+#define CELL_CONCATENATE(a, b) CELL_CONCATENATE_EXPANDED(a, b)
+#define CELL_CONCATENATE_EXPANDED(a, b) a##b
+
 // Packing attribute for offsets in structures.
 #define CELL_PACKED(x) __attribute__((packed, aligned(x)))
 
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/System/Entry.hh>
 
 #include <stdio.h>
@@ -11,8 +12,14 @@ int main() {
     const int std_result = setvbuf(stdout, nullptr, _IONBF, 0);
     CELL_ASSERT(std_result == 0);
 
-    String a = "";
-    CellEntry(Reference(a));
+    {
+        String a = "";
+        CellEntry(Reference(a));
+    }
+
+#ifdef CELL_CORE_MEMORY_TRACKING
+    Memory::ReportLeaks();
+#endif
 
     return 0;
 }
@@ -2,16 +2,23 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/IO/File.hh>
+#include <Cell/System/Metrics.hh>
 
 #include <errno.h>
 #include <stdio.h>
 
 namespace Cell::IO {
 
+// Bytes moved through files, across all of them.
+static System::MetricCounter bytesRead("io.bytes_read");
+static System::MetricCounter bytesWritten("io.bytes_written");
+
 Result File::Read(Memory::IBlock& data) {
     FILE* file = (FILE*)this->impl;
 
     const size_t readCount = fread(data.AsPointer(), data.GetElementSize(), data.GetCount(), file);
+    bytesRead.Add(readCount * data.GetElementSize());
+
     if (readCount != data.GetCount()) {
         if (feof(file) != 0) {
             return Result::ReachedEnd;
@@ -53,6 +60,8 @@ Result File::Write(const Memory::IBlock& data) {
     FILE* file = (FILE*)this->impl;
 
     const size_t writeCount = fwrite(data.AsPointer(), data.GetElementSize(), data.GetCount(), file);
+    bytesWritten.Add(writeCount * data.GetElementSize());
+
     if (writeCount != data.GetCount()) {
         if (feof(file) != 0) {
             return Result::ReachedEnd;
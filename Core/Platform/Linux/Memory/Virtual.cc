@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Memory/Virtual.hh>
+#include <Cell/System/Panic.hh>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Cell::Memory {
+
+size_t GetPageSize() {
+    static size_t pageSize = 0;
+    if (pageSize == 0) {
+        const long result = sysconf(_SC_PAGESIZE);
+        CELL_ASSERT(result > 0);
+
+        pageSize = (size_t)result;
+    }
+
+    return pageSize;
+}
+
+void* VirtualReserve(const size_t size) {
+    CELL_ASSERT(size > 0);
+
+    void* address = mmap(nullptr, RoundToPageSize(size), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    CELL_ASSERT(address != MAP_FAILED);
+
+    return address;
+}
+
+void VirtualCommit(void* address, const size_t size) {
+    CELL_ASSERT(((uintptr_t)address & (GetPageSize() - 1)) == 0 && size > 0);
+
+    const int result = mprotect(address, RoundToPageSize(size), PROT_READ | PROT_WRITE);
+    CELL_ASSERT(result == 0);
+}
+
+void VirtualDecommit(void* address, const size_t size) {
+    CELL_ASSERT(((uintptr_t)address & (GetPageSize() - 1)) == 0 && size > 0);
+
+    // anonymous private pages are dropped right away and read back as zero afterwards
+    int result = madvise(address, RoundToPageSize(size), MADV_DONTNEED);
+    CELL_ASSERT(result == 0);
+
+    result = mprotect(address, RoundToPageSize(size), PROT_NONE);
+    CELL_ASSERT(result == 0);
+}
+
+void VirtualRelease(void* address, const size_t size) {
+    const int result = munmap(address, RoundToPageSize(size));
+    CELL_ASSERT(result == 0);
+}
+
+}
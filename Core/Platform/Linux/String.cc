@@ -22,7 +22,7 @@ Wrapped<String, StringDetails::Result> String::FromPlatformWideString(const wcha
 }
 
 wchar_t* String::ToPlatformWideString() const {
-    CELL_ASSERT(this->data != nullptr && this->size > 0);
+    CELL_ASSERT(this->size > 0);
 
     // mbstowcs desires null termination
     ScopedBlock dataStr = this->ToCharPointer();
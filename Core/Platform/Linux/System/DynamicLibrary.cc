@@ -44,8 +44,9 @@ DynamicLibrary::~DynamicLibrary() {
 }
 
 Wrapped<GenericFunctionPointer, Result> DynamicLibrary::GetFunction(const String& name) {
-    if (this->loadedFunctions.Has(name)) {
-        return this->loadedFunctions.GetValue(name);
+    GenericFunctionPointer* loaded = this->loadedFunctions.Find(name);
+    if (loaded != nullptr) {
+        return *loaded;
     }
 
     ScopedBlock<char> nameStr = name.ToCharPointer();
@@ -63,7 +64,7 @@ Wrapped<GenericFunctionPointer, Result> DynamicLibrary::GetFunction(const String
         }
     }
 
-    this->loadedFunctions.Append(name, function);
+    this->loadedFunctions.Set(name, function);
     return function;
 }
 
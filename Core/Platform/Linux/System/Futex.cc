@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Panic.hh>
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace Cell::System {
+
+Result FutexWait(const uint32_t* address, const uint32_t expected, const uint32_t timeoutMs) {
+    // FUTEX_WAIT takes a relative timeout
+    const struct timespec timeout = {
+        .tv_sec  = timeoutMs / 1000,
+        .tv_nsec = (timeoutMs % 1000) * 1000000
+    };
+
+    const long result = syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, timeoutMs > 0 ? &timeout : nullptr, nullptr, 0);
+    if (result == 0) {
+        return Result::Success;
+    }
+
+    switch (errno) {
+    case EAGAIN: // the value had already changed
+    case EINTR: {
+        return Result::Success;
+    }
+
+    case ETIMEDOUT: {
+        return Result::Timeout;
+    }
+
+    default: {
+        System::Panic("futex wait failed");
+    }
+    }
+}
+
+void FutexWake(const uint32_t* address) {
+    const long result = syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    CELL_ASSERT(result >= 0);
+}
+
+void FutexWakeAll(const uint32_t* address) {
+    const long result = syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+    CELL_ASSERT(result >= 0);
+}
+
+}
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Panic.hh>
+#include <Cell/System/PerfCounters.hh>
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Cell::System {
+
+struct PerfCountersInfo : public Object {
+    // file descriptors of the events, -1 for unavailable ones; the first one opened leads the group
+    int descriptors[PerfCounterCount];
+    uint64_t ids[PerfCounterCount];
+
+    int leader;
+    uint8_t available;
+};
+
+// Event type and configuration for each PerfCounter.
+static const struct {
+    uint32_t type;
+    uint64_t config;
+} perfEvents[PerfCounterCount] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS }
+};
+
+Wrapped<PerfCounters*, Result> PerfCounters::Open() {
+    PerfCountersInfo* info = new PerfCountersInfo;
+    info->leader = -1;
+    info->available = 0;
+
+    bool denied = false;
+    for (size_t i = 0; i < PerfCounterCount; i++) {
+        info->descriptors[i] = -1;
+        info->ids[i] = 0;
+
+        perf_event_attr attributes = { };
+        attributes.size = sizeof(perf_event_attr);
+        attributes.type = perfEvents[i].type;
+        attributes.config = perfEvents[i].config;
+        attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // the leader starts the whole group once everything's in place
+        attributes.disabled = info->leader < 0 ? 1 : 0;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        const int descriptor = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, info->leader, PERF_FLAG_FD_CLOEXEC);
+        if (descriptor < 0) {
+            switch (errno) {
+            case EACCES:
+            case EPERM: {
+                denied = true;
+                break;
+            }
+
+            // the event doesn't exist here, can't be grouped with the others, or there's nothing left to count it with
+            case ENOENT:
+            case EOPNOTSUPP:
+            case EINVAL:
+            case ENODEV:
+            case EMFILE:
+            case ENFILE:
+            case ENOMEM: {
+                break;
+            }
+
+            default: {
+                System::Panic("perf_event_open failed");
+            }
+            }
+
+            continue;
+        }
+
+        if (ioctl(descriptor, PERF_EVENT_IOC_ID, &info->ids[i]) != 0) {
+            close(descriptor);
+            continue;
+        }
+
+        if (info->leader < 0) {
+            info->leader = descriptor;
+        }
+
+        info->descriptors[i] = descriptor;
+        info->available |= (uint8_t)(1 << i);
+    }
+
+    if (info->leader < 0) {
+        delete info;
+        return denied ? Result::AccessDenied : Result::Unsupported;
+    }
+
+    ioctl(info->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(info->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+    return new PerfCounters((uintptr_t)info);
+}
+
+PerfCounters::~PerfCounters() {
+    PerfCountersInfo* info = (PerfCountersInfo*)this->impl;
+
+    // members go before the leader, which would otherwise take the group down with it
+    for (size_t i = PerfCounterCount; i > 0; i--) {
+        if (info->descriptors[i - 1] >= 0 && info->descriptors[i - 1] != info->leader) {
+            close(info->descriptors[i - 1]);
+        }
+    }
+
+    close(info->leader);
+    delete info;
+}
+
+PerfSample PerfCounters::Read() const {
+    PerfCountersInfo* info = (PerfCountersInfo*)this->impl;
+
+    PerfSample sample = { .values = { 0 }, .available = info->available };
+
+    // event count, time enabled and running, then a value and ID per event
+    uint64_t data[3 + 2 * PerfCounterCount];
+
+    const ssize_t result = read(info->leader, data, sizeof(data));
+    CELL_ASSERT(result >= (ssize_t)(3 * sizeof(uint64_t)));
+
+    const uint64_t count = data[0];
+    const uint64_t enabled = data[1];
+    const uint64_t running = data[2];
+
+    for (uint64_t i = 0; i < count && i < PerfCounterCount; i++) {
+        uint64_t value = data[3 + i * 2];
+        const uint64_t id = data[4 + i * 2];
+
+        // with more events than hardware counters, the kernel takes turns; the counts are scaled up to the full time then
+        if (running > 0 && running < enabled) {
+            value = (uint64_t)((unsigned __int128)value * enabled / running);
+        }
+
+        for (size_t j = 0; j < PerfCounterCount; j++) {
+            if (info->descriptors[j] >= 0 && info->ids[j] == id) {
+                sample.values[j] = value;
+                break;
+            }
+        }
+    }
+
+    return sample;
+}
+
+bool PerfCounters::IsAvailable(const PerfCounter counter) const {
+    PerfCountersInfo* info = (PerfCountersInfo*)this->impl;
+    return (info->available & (1 << (uint8_t)counter)) != 0;
+}
+
+}
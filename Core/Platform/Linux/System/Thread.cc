@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Memory/Slab.hh>
 #include <Cell/Scoped.hh>
 #include <Cell/System/Event.hh>
 #include <Cell/System/Panic.hh>
@@ -8,42 +9,178 @@
 
 #include <errno.h>
 #include <pthread.h>
+#include <sched.h>
 #include <signal.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
 
 namespace Cell::System {
 
-struct ThreadData {
-    Event* event;
+// Nice values used for the regular priority classes.
+constexpr int NiceLow  = 10;
+constexpr int NiceHigh = -10;
+
+// Priority used for real-time threads; low within the range, as is common for audio.
+constexpr int RealTimePriority = 10;
+
+enum ThreadState : uint32_t {
+    Running,
+    Finished,
+
+    // the thread object was destroyed while the thread still ran
+    Abandoned
+};
+
+// Shared between the thread object and the thread itself; whichever is done last frees it.
+struct ThreadInfo : public Object {
+    pthread_t thread;
+    pid_t id;
+
+    uint32_t state;
+    bool joined;
+
+    Event started;
     ThreadFunction function;
     void* parameter;
-    uintptr_t* handle;
 };
 
-void* ThreadTrampoline(void* param) {
-    struct ThreadData data = *(struct ThreadData*)param;
-    data.event->Signal();
-    data.function(data.parameter);
-    *data.handle = 0;
+void* ThreadTrampoline(void* parameter) {
+    ThreadInfo* info = (ThreadInfo*)parameter;
+
+    info->id = (pid_t)syscall(SYS_gettid);
+    info->started.Signal();
+
+    info->function(info->parameter);
+
+    uint32_t expected = Running;
+    if (!__atomic_compare_exchange_n(&info->state, &expected, Finished, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        delete info;
+    }
+
+    Memory::SlabReleaseThreadCache();
     return nullptr;
 }
 
-Thread::Thread(ThreadFunction function, void* parameter, const String& name) {
-    Event event;
+CELL_FUNCTION_INTERNAL Result SetPriorityForId(const pid_t id, const ThreadPriority priority) {
+    struct sched_param parameters = { .sched_priority = 0 };
+    int policy = SCHED_OTHER;
+    int nice = 0;
+
+    switch (priority) {
+    case ThreadPriority::Idle: {
+        policy = SCHED_IDLE;
+        break;
+    }
+
+    case ThreadPriority::Low: {
+        nice = NiceLow;
+        break;
+    }
+
+    case ThreadPriority::Normal: {
+        break;
+    }
+
+    case ThreadPriority::High: {
+        nice = NiceHigh;
+        break;
+    }
+
+    case ThreadPriority::RealTime: {
+        policy = SCHED_FIFO;
+        parameters.sched_priority = RealTimePriority;
+        break;
+    }
 
-    const ThreadData data = {
-        .event     = &event,
-        .function  = function,
-        .parameter = parameter,
-        .handle    = &this->impl
-    };
+    default: {
+        return Result::InvalidParameters;
+    }
+    }
+
+    // threads spawned from real-time threads shouldn't inherit the policy
+    int result = sched_setscheduler(id, policy | SCHED_RESET_ON_FORK, &parameters);
+    if (result == 0 && policy == SCHED_OTHER) {
+        result = setpriority(PRIO_PROCESS, (id_t)id, nice);
+    }
+
+    if (result == 0) {
+        return Result::Success;
+    }
+
+    switch (errno) {
+    case EACCES:
+    case EPERM: {
+        return Result::AccessDenied;
+    }
+
+    case ESRCH: {
+        return Result::Expired;
+    }
+
+    case EINVAL: {
+        return Result::InvalidParameters;
+    }
+
+    default: {
+        System::Panic("sched_setscheduler/setpriority failed");
+    }
+    }
+}
 
-    pthread_t thread = 0;
-    const int result = pthread_create(&thread, nullptr, ThreadTrampoline, (void**)&data);
+CELL_FUNCTION_INTERNAL Result SetAffinityForId(const pid_t id, const uint64_t mask) {
+    if (mask == 0) {
+        return Result::InvalidParameters;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    for (uint32_t i = 0; i < 64; i++) {
+        if ((mask & (1ull << i)) != 0) {
+            CPU_SET(i, &set);
+        }
+    }
+
+    const int result = sched_setaffinity(id, sizeof(cpu_set_t), &set);
+    if (result == 0) {
+        return Result::Success;
+    }
+
+    switch (errno) {
+    case EPERM: {
+        return Result::AccessDenied;
+    }
+
+    case ESRCH: {
+        return Result::Expired;
+    }
+
+    case EINVAL: { // none of the processors are available
+        return Result::InvalidParameters;
+    }
+
+    default: {
+        System::Panic("sched_setaffinity failed");
+    }
+    }
+}
+
+Thread::Thread(ThreadFunction function, void* parameter, const String& name) {
+    ThreadInfo* info = new ThreadInfo;
+    info->id = 0;
+    info->state = Running;
+    info->joined = false;
+    info->function = function;
+    info->parameter = parameter;
+
+    const int result = pthread_create(&info->thread, nullptr, ThreadTrampoline, info);
     CELL_ASSERT(result == 0);
 
-    event.Wait();
+    info->started.Wait();
 
-    this->impl = (uintptr_t)thread;
+    this->impl = (uintptr_t)info;
 
     if (!name.IsEmpty()) {
         this->SetName(name);
@@ -51,33 +188,53 @@ Thread::Thread(ThreadFunction function, void* parameter, const String& name) {
 }
 
 Thread::~Thread() {
-    if (this->impl != 0) {
-        pthread_kill((pthread_t)this->impl, SIGTERM);
+    ThreadInfo* info = (ThreadInfo*)this->impl;
+    if (info->joined) {
+        delete info;
+        return;
+    }
+
+    uint32_t expected = Running;
+    if (__atomic_compare_exchange_n(&info->state, &expected, Abandoned, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        // the thread frees the info itself, should it survive this
+        pthread_kill(info->thread, SIGTERM);
+        pthread_detach(info->thread);
+        return;
     }
+
+    // finished, but not joined yet; joining releases its resources
+    pthread_join(info->thread, nullptr);
+    delete info;
 }
 
 Result Thread::Join(const uint32_t timeoutMs) const {
-    if (this->impl == 0) {
-        return Result::Expired;
+    ThreadInfo* info = (ThreadInfo*)this->impl;
+    if (info->joined) {
+        return Result::Success;
     }
 
     int result = 0;
 
     if (timeoutMs > 0) {
-        struct timespec timeout = { .tv_sec = 0, .tv_nsec = timeoutMs * 1000 };
-        if (timeoutMs >= 1000) {
-            timeout.tv_sec = timeoutMs / 1000;
-            timeout.tv_nsec = (timeoutMs % 1000) * 1000;
+        // pthread_timedjoin_np takes an absolute time on the realtime clock
+        struct timespec timeout = { };
+        clock_gettime(CLOCK_REALTIME, &timeout);
+
+        timeout.tv_sec += timeoutMs / 1000;
+        timeout.tv_nsec += (timeoutMs % 1000) * 1000000;
+        if (timeout.tv_nsec >= 1000000000) {
+            timeout.tv_sec++;
+            timeout.tv_nsec -= 1000000000;
         }
 
-        result = pthread_timedjoin_np((pthread_t)this->impl, nullptr, &timeout);
+        result = pthread_timedjoin_np(info->thread, nullptr, &timeout);
     } else {
-        result = pthread_join((pthread_t)this->impl, nullptr);
+        result = pthread_join(info->thread, nullptr);
     }
 
     switch (result) {
-    case 0:
-    case ESRCH: { // thread already died
+    case 0: {
+        info->joined = true;
         return Result::Success;
     }
 
@@ -92,28 +249,13 @@ Result Thread::Join(const uint32_t timeoutMs) const {
 }
 
 bool Thread::IsActive() const {
-    if (this->impl == 0) {
-        return false;
-    }
-
-    const int result = pthread_tryjoin_np((pthread_t)this->impl, nullptr);
-    switch (result) {
-    case 0: {
-        return false;
-    }
-
-    case EBUSY: {
-        return true;
-    }
-
-    default: {
-        System::Panic("pthread_tryjoin_np failed");
-    }
-    }
+    ThreadInfo* info = (ThreadInfo*)this->impl;
+    return __atomic_load_n(&info->state, __ATOMIC_ACQUIRE) == Running;
 }
 
 Result Thread::SetName(const String& name) {
-    if (this->impl == 0) {
+    ThreadInfo* info = (ThreadInfo*)this->impl;
+    if (info->joined) {
         return Result::Expired;
     }
 
@@ -122,7 +264,7 @@ Result Thread::SetName(const String& name) {
     }
 
     ScopedBlock nameStr = name.ToCharPointer();
-    const int result = pthread_setname_np(this->impl, &nameStr);
+    const int result = pthread_setname_np(info->thread, &nameStr);
     switch (result) {
     case 0: {
         break;
@@ -145,9 +287,44 @@ Result Thread::SetName(const String& name) {
     return Result::Success;
 }
 
+Result Thread::SetPriority(const ThreadPriority priority) {
+    ThreadInfo* info = (ThreadInfo*)this->impl;
+    if (!this->IsActive()) {
+        return Result::Expired;
+    }
+
+    return SetPriorityForId(info->id, priority);
+}
+
+Result Thread::SetAffinity(const uint64_t mask) {
+    ThreadInfo* info = (ThreadInfo*)this->impl;
+    if (!this->IsActive()) {
+        return Result::Expired;
+    }
+
+    return SetAffinityForId(info->id, mask);
+}
+
+Result Thread::SetCurrentPriority(const ThreadPriority priority) {
+    return SetPriorityForId((pid_t)syscall(SYS_gettid), priority);
+}
+
+Result Thread::SetCurrentAffinity(const uint64_t mask) {
+    return SetAffinityForId((pid_t)syscall(SYS_gettid), mask);
+}
+
 void Thread::Yield() {
     const int result = sched_yield();
     CELL_ASSERT(result == 0);
 }
 
+uint32_t Thread::GetProcessorCount() {
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (uint32_t)count : 1;
+}
+
+uint64_t Thread::GetCurrentId() {
+    return (uint64_t)syscall(SYS_gettid);
+}
+
 }
@@ -4,6 +4,7 @@
 #include <Cell/System/Panic.hh>
 #include <Cell/System/Timer.hh>
 
+#include <errno.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -17,18 +18,36 @@ uint64_t GetPreciseTickerValue() {
     return timespec.tv_nsec / 1000 + timespec.tv_sec * 1000000;
 }
 
+uint64_t GetPreciseTickerNanoseconds() {
+    timespec timespec { };
+    const int result = clock_gettime(CLOCK_MONOTONIC, &timespec);
+    CELL_ASSERT(result == 0);
+
+    return timespec.tv_nsec + timespec.tv_sec * 1000000000ull;
+}
+
 void Sleep(const uint32_t milliseconds) {
     const int result = usleep(milliseconds * 1000);
     CELL_ASSERT(result == 0);
 }
 
-void SleepPrecise(const uint64_t nanoseconds) {
-    const struct timespec timeout = {
-        .tv_sec  = (__time_t)(nanoseconds / 1000000000),
-        .tv_nsec = (__time_t)(nanoseconds % 1000000000)
+void SleepPrecise(const uint64_t microseconds) {
+    SleepUntil(GetPreciseTickerValue() + microseconds);
+}
+
+void SleepUntil(const uint64_t deadline) {
+    // the ticker is based on the monotonic clock, so the deadline can be handed over as is
+    const struct timespec time = {
+        .tv_sec  = (__time_t)(deadline / 1000000),
+        .tv_nsec = (__syscall_slong_t)(deadline % 1000000 * 1000)
     };
 
-    const int result = nanosleep(&timeout, nullptr);
+    int result = 0;
+    do {
+        // absolute deadlines can simply be retried after being interrupted
+        result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr);
+    } while (result == EINTR);
+
     CELL_ASSERT(result == 0);
 }
 
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Topology.hh>
+
+#include <fcntl.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace Cell::System {
+
+// Reads a number from a sysfs attribute of the given processor, falling back to the given value if it's missing.
+CELL_FUNCTION_INTERNAL uint32_t ReadProcessorAttribute(const uint32_t processor, const char* attribute, const uint32_t fallback) {
+    char path[128];
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/%s", processor, attribute);
+
+    const int file = open(path, O_RDONLY | O_CLOEXEC);
+    if (file < 0) {
+        return fallback;
+    }
+
+    char buffer[32] = { 0 };
+    const ssize_t read = ::read(file, buffer, sizeof(buffer) - 1);
+    close(file);
+
+    if (read <= 0) {
+        return fallback;
+    }
+
+    char* end = nullptr;
+    const long value = strtol(buffer, &end, 10);
+    if (end == buffer || value < 0) {
+        return fallback;
+    }
+
+    return (uint32_t)value;
+}
+
+Wrapped<ProcessorTopology*, Result> ProcessorTopology::Query() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    const int result = sched_getaffinity(0, sizeof(cpu_set_t), &set);
+    if (result != 0) {
+        return Result::Unsupported;
+    }
+
+    Collection::List<LogicalProcessor> processors;
+
+    for (uint32_t i = 0; i < 64; i++) {
+        if (!CPU_ISSET(i, &set)) {
+            continue;
+        }
+
+        // without topology information, every processor is treated as its own core, with one cache for all of them
+        processors.Append({
+            .index      = i,
+            .core       = ReadProcessorAttribute(i, "topology/core_id", i),
+            .cacheGroup = ReadProcessorAttribute(i, "cache/index3/id", 0),
+            .package    = ReadProcessorAttribute(i, "topology/physical_package_id", 0)
+        });
+    }
+
+    if (processors.IsEmpty()) {
+        return Result::Unsupported;
+    }
+
+    return new ProcessorTopology(processors);
+}
+
+}
@@ -93,7 +93,7 @@ Wrapped<Collection::List<String>, Result> Directory::Enumerate(const String& fil
             if (useFullPaths) {
                 files.Append(path + "\\" + conversion);
             } else {
-                files.Append(conversion);
+                files.Append(Utilities::Move(conversion));
             }
         }
 
@@ -163,7 +163,7 @@ Wrapped<Collection::List<String>, Result> Directory::EnumerateDirectories(const
             if (useFullPaths) {
                 folders.Append(path + "\\" + conversion);
             } else {
-                folders.Append(conversion);
+                folders.Append(Utilities::Move(conversion));
             }
         }
 
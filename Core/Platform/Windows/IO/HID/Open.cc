@@ -24,7 +24,9 @@ CELL_FUNCTION_INTERNAL deviceProps parseDevicePathHID(const wchar_t* data) {
 
     const size_t pidOffset = StringDetails::RawStringSize("_PID&");
 
-    String path = String::FromPlatformWideString(data).Unwrap();
+    const String converted = String::FromPlatformWideString(data).Unwrap();
+    const StringView path = converted;
+
     if (path.BeginsWith("HID\\VID")) { // USB
         const size_t offset = StringDetails::RawStringSize("HID\\VID_");
 
@@ -25,7 +25,9 @@ CELL_FUNCTION_INTERNAL deviceProps parseDevicePath(const wchar_t* data) {
     const size_t pidOffset = StringDetails::RawStringSize("_PID&");
     const size_t interfaceOffset = StringDetails::RawStringSize("&REV_0000&MI_");
 
-    String path = String::FromPlatformWideString(data).Unwrap();
+    const String converted = String::FromPlatformWideString(data).Unwrap();
+    const StringView path = converted;
+
     if (path.BeginsWith("USB\\VID")) {
         const size_t offset = StringDetails::RawStringSize("USB\\VID_");
 
@@ -2,32 +2,69 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/System/Panic.hh>
 #include <Cell/System/Platform/Windows/Includes.h>
 
+#include <malloc.h>
+
 namespace Cell::Memory {
 
 void* Allocate(const size_t size) {
     CELL_ASSERT(size > 0);
 
-    void* buffer = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, size);
+    void* buffer = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, size + TrackingDetails::HeaderSize);
     CELL_ASSERT(buffer != nullptr);
 
-    return buffer;
+    return TrackingDetails::Track(buffer, size);
 }
 
-void Reallocate(void*& buffer, const size_t size) {
+void* AllocateUninitialized(const size_t size) {
     CELL_ASSERT(size > 0);
 
-    buffer = HeapReAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, buffer, size);
+    void* buffer = HeapAlloc(GetProcessHeap(), 0, size + TrackingDetails::HeaderSize);
     CELL_ASSERT(buffer != nullptr);
+
+    return TrackingDetails::Track(buffer, size);
+}
+
+void Reallocate(void*& buffer, const size_t size) {
+    CELL_ASSERT(size > 0);
+
+    void* base = HeapReAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, TrackingDetails::Untrack(buffer), size + TrackingDetails::HeaderSize);
+    CELL_ASSERT(base != nullptr);
+
+    buffer = TrackingDetails::Retrack(base, size);
 }
 
 void Free(const void* buffer) {
-    const BOOL result = HeapFree(GetProcessHeap(), 0, (void*)buffer);
+    const BOOL result = HeapFree(GetProcessHeap(), 0, TrackingDetails::Untrack(buffer));
     CELL_ASSERT(result);
 }
 
+void* AllocateAligned(const size_t size, const size_t alignment) {
+    CELL_ASSERT(size > 0 && alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    void* buffer = _aligned_malloc(size + TrackingDetails::GetPadding(alignment), alignment);
+    CELL_ASSERT(buffer != nullptr);
+
+    return TrackingDetails::Track(buffer, size, TrackingDetails::GetPadding(alignment));
+}
+
+void ReallocateAligned(void*& buffer, const size_t oldSize, const size_t size, const size_t alignment) {
+    (void)(oldSize);
+    CELL_ASSERT(size > 0);
+
+    void* base = _aligned_realloc(TrackingDetails::Untrack(buffer), size + TrackingDetails::GetPadding(alignment), alignment);
+    CELL_ASSERT(base != nullptr);
+
+    buffer = TrackingDetails::Retrack(base, size, TrackingDetails::GetPadding(alignment));
+}
+
+void FreeAligned(const void* buffer) {
+    _aligned_free(TrackingDetails::Untrack(buffer));
+}
+
 void Copy(void* destination, const void* source, const size_t size) {
     CELL_ASSERT(size > 0);
 
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Memory/Virtual.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/System/Platform/Windows/Includes.h>
+
+namespace Cell::Memory {
+
+size_t GetPageSize() {
+    static size_t pageSize = 0;
+    if (pageSize == 0) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+
+        pageSize = info.dwPageSize;
+    }
+
+    return pageSize;
+}
+
+void* VirtualReserve(const size_t size) {
+    CELL_ASSERT(size > 0);
+
+    void* address = VirtualAlloc(nullptr, RoundToPageSize(size), MEM_RESERVE, PAGE_NOACCESS);
+    CELL_ASSERT(address != nullptr);
+
+    return address;
+}
+
+void VirtualCommit(void* address, const size_t size) {
+    CELL_ASSERT(((uintptr_t)address & (GetPageSize() - 1)) == 0 && size > 0);
+
+    void* result = VirtualAlloc(address, RoundToPageSize(size), MEM_COMMIT, PAGE_READWRITE);
+    CELL_ASSERT(result != nullptr);
+}
+
+void VirtualDecommit(void* address, const size_t size) {
+    CELL_ASSERT(((uintptr_t)address & (GetPageSize() - 1)) == 0 && size > 0);
+
+    const BOOL result = VirtualFree(address, RoundToPageSize(size), MEM_DECOMMIT);
+    CELL_ASSERT(result);
+}
+
+void VirtualRelease(void* address, const size_t size) {
+    (void)(size);
+
+    const BOOL result = VirtualFree(address, 0, MEM_RELEASE);
+    CELL_ASSERT(result);
+}
+
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Network/Socket.hh>
+#include <Cell/System/Metrics.hh>
 #include <Cell/System/Panic.hh>
 
 #include <Cell/System/Platform/Windows/Includes.h>
@@ -10,6 +11,10 @@
 
 namespace Cell::Network {
 
+// Bytes moved through sockets, across all of them.
+static System::MetricCounter bytesSent("network.bytes_sent");
+static System::MetricCounter bytesReceived("network.bytes_received");
+
 Result Socket::Send(const Memory::IBlock& data, const bool isOutOfBand) {
     if (data.GetSize() > INT32_MAX) {
         return Result::InvalidParameters;
@@ -43,6 +48,8 @@ Result Socket::Send(const Memory::IBlock& data, const bool isOutOfBand) {
         }
     }
 
+    bytesSent.Add(sent);
+
     return Result::Success;
 }
 
@@ -80,6 +87,8 @@ Result Socket::Receive(Memory::IBlock& data) {
         }
     }
 
+    bytesReceived.Add(received);
+
     return Result::Success;
 }
 
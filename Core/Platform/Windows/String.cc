@@ -35,11 +35,11 @@ wchar_t* String::ToPlatformWideString() const {
 
     const int size = this->GetSize();
 
-    int outputSize = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, this->data, size, nullptr, 0);
+    int outputSize = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, this->GetData(), size, nullptr, 0);
     CELL_ASSERT(outputSize > 0);
 
     wchar_t* output = Memory::Allocate<wchar_t>(outputSize + 1);
-    outputSize = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, this->data, size, output, outputSize);
+    outputSize = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, this->GetData(), size, output, outputSize);
     CELL_ASSERT(outputSize > 0);
 
     return output;
@@ -33,8 +33,9 @@ DynamicLibrary::~DynamicLibrary() {
 }
 
 Wrapped<GenericFunctionPointer, Result> DynamicLibrary::GetFunction(const String& name) {
-    if (this->loadedFunctions.Has(name).IsValid()) {
-        return (GenericFunctionPointer)this->loadedFunctions.GetValue(name);
+    GenericFunctionPointer* loaded = this->loadedFunctions.Find(name);
+    if (loaded != nullptr) {
+        return *loaded;
     }
 
     ScopedBlock<char> namePtr = name.ToCharPointer();
@@ -51,7 +52,7 @@ Wrapped<GenericFunctionPointer, Result> DynamicLibrary::GetFunction(const String
         }
     }
 
-    this->loadedFunctions.Append(name, (GenericFunctionPointer)proc);
+    this->loadedFunctions.Set(name, (GenericFunctionPointer)proc);
     return (GenericFunctionPointer)proc;
 }
 
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/System/Platform/Windows/Includes.h>
+
+namespace Cell::System {
+
+Result FutexWait(const uint32_t* address, const uint32_t expected, const uint32_t timeoutMs) {
+    uint32_t compare = expected;
+
+    const BOOL result = WaitOnAddress((volatile void*)address, &compare, sizeof(uint32_t), timeoutMs == 0 ? INFINITE : timeoutMs);
+    if (result == TRUE) {
+        return Result::Success;
+    }
+
+    if (GetLastError() == ERROR_TIMEOUT) {
+        return Result::Timeout;
+    }
+
+    System::Panic("WaitOnAddress failed");
+}
+
+void FutexWake(const uint32_t* address) {
+    WakeByAddressSingle((void*)address);
+}
+
+void FutexWakeAll(const uint32_t* address) {
+    WakeByAddressAll((void*)address);
+}
+
+}
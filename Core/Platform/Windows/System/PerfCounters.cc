@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Panic.hh>
+#include <Cell/System/PerfCounters.hh>
+
+namespace Cell::System {
+
+// There is no counterpart to perf_event_open here; as opening always fails, nothing else is ever reached.
+
+Wrapped<PerfCounters*, Result> PerfCounters::Open() {
+    return Result::Unsupported;
+}
+
+PerfCounters::~PerfCounters() {
+    System::Panic("Cell::System::PerfCounters is unsupported");
+}
+
+PerfSample PerfCounters::Read() const {
+    System::Panic("Cell::System::PerfCounters is unsupported");
+}
+
+bool PerfCounters::IsAvailable(const PerfCounter counter) const {
+    (void)(counter);
+
+    System::Panic("Cell::System::PerfCounters is unsupported");
+}
+
+}
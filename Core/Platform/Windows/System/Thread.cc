@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Memory/Slab.hh>
 #include <Cell/Scoped.hh>
 #include <Cell/System/Event.hh>
 #include <Cell/System/Panic.hh>
@@ -9,6 +10,80 @@
 
 namespace Cell::System {
 
+CELL_FUNCTION_INTERNAL Result SetPriorityForHandle(HANDLE thread, const ThreadPriority priority) {
+    int value = THREAD_PRIORITY_NORMAL;
+    switch (priority) {
+    case ThreadPriority::Idle: {
+        value = THREAD_PRIORITY_IDLE;
+        break;
+    }
+
+    case ThreadPriority::Low: {
+        value = THREAD_PRIORITY_BELOW_NORMAL;
+        break;
+    }
+
+    case ThreadPriority::Normal: {
+        break;
+    }
+
+    case ThreadPriority::High: {
+        value = THREAD_PRIORITY_HIGHEST;
+        break;
+    }
+
+    case ThreadPriority::RealTime: {
+        // only truly real-time within the real-time priority class of the process, which is left to the application
+        value = THREAD_PRIORITY_TIME_CRITICAL;
+        break;
+    }
+
+    default: {
+        return Result::InvalidParameters;
+    }
+    }
+
+    const BOOL result = SetThreadPriority(thread, value);
+    if (!result) {
+        switch (GetLastError()) {
+        case ERROR_ACCESS_DENIED: {
+            return Result::AccessDenied;
+        }
+
+        default: {
+            System::Panic("SetThreadPriority failed");
+        }
+        }
+    }
+
+    return Result::Success;
+}
+
+CELL_FUNCTION_INTERNAL Result SetAffinityForHandle(HANDLE thread, const uint64_t mask) {
+    if (mask == 0) {
+        return Result::InvalidParameters;
+    }
+
+    const DWORD_PTR result = SetThreadAffinityMask(thread, (DWORD_PTR)mask);
+    if (result == 0) {
+        switch (GetLastError()) {
+        case ERROR_ACCESS_DENIED: {
+            return Result::AccessDenied;
+        }
+
+        case ERROR_INVALID_PARAMETER: { // none of the processors are available
+            return Result::InvalidParameters;
+        }
+
+        default: {
+            System::Panic("SetThreadAffinityMask failed");
+        }
+        }
+    }
+
+    return Result::Success;
+}
+
 struct threadData {
     Event* event;
     ThreadFunction function;
@@ -20,6 +95,8 @@ DWORD threadTrampoline(void* param) {
     data.event->Signal();
 
     data.function(data.parameter);
+
+    Memory::SlabReleaseThreadCache();
     return 0;
 }
 
@@ -99,8 +176,43 @@ Result Thread::SetName(const String& name) {
     return Result::Success;
 }
 
+Result Thread::SetPriority(const ThreadPriority priority) {
+    if (!this->IsActive()) {
+        return Result::Expired;
+    }
+
+    return SetPriorityForHandle((HANDLE)this->impl, priority);
+}
+
+Result Thread::SetAffinity(const uint64_t mask) {
+    if (!this->IsActive()) {
+        return Result::Expired;
+    }
+
+    return SetAffinityForHandle((HANDLE)this->impl, mask);
+}
+
+Result Thread::SetCurrentPriority(const ThreadPriority priority) {
+    return SetPriorityForHandle(GetCurrentThread(), priority);
+}
+
+Result Thread::SetCurrentAffinity(const uint64_t mask) {
+    return SetAffinityForHandle(GetCurrentThread(), mask);
+}
+
 void Thread::Yield() {
     SwitchToThread();
 }
 
+uint32_t Thread::GetProcessorCount() {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors;
+}
+
+uint64_t Thread::GetCurrentId() {
+    return GetCurrentThreadId();
+}
+
 }
@@ -21,6 +21,16 @@ uint64_t GetPreciseTickerValue() {
     return (counter * 1000000) / freq; // sec -> usec, freq -> tick/Hz
 }
 
+uint64_t GetPreciseTickerNanoseconds() {
+    int64_t counter, freq = 0;
+
+    const int32_t result = NtQueryPerformanceCounter(&counter, &freq);
+    CELL_ASSERT(result == ERROR_SUCCESS);
+
+    // split up, as the counter times a billion overflows within hours at common frequencies
+    return (counter / freq) * 1000000000 + ((counter % freq) * 1000000000) / freq;
+}
+
 void Sleep(const uint32_t milliseconds) {
     ::Sleep(milliseconds);
 }
@@ -28,9 +38,17 @@ void Sleep(const uint32_t milliseconds) {
 void SleepPrecise(const uint64_t microseconds) {
     CELL_ASSERT(microseconds <= INT64_MAX);
 
-    int64_t converted = microseconds * 10; // expects 100 ns
+    int64_t converted = -(int64_t)(microseconds * 10); // expects 100 ns, with negative values being relative
     const int32_t result = NtDelayExecution(TRUE, &converted);
     CELL_ASSERT(result == ERROR_SUCCESS);
 }
 
+void SleepUntil(const uint64_t deadline) {
+    // absolute delays are in system time, which isn't monotonic
+    const uint64_t now = GetPreciseTickerValue();
+    if (now < deadline) {
+        SleepPrecise(deadline - now);
+    }
+}
+
 }
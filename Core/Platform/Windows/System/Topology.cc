@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Scoped.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/System/Platform/Windows/Includes.h>
+#include <Cell/System/Topology.hh>
+
+namespace Cell::System {
+
+Wrapped<ProcessorTopology*, Result> ProcessorTopology::Query() {
+    DWORD size = 0;
+    BOOL result = GetLogicalProcessorInformationEx(RelationAll, nullptr, &size);
+    if (result || GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+        return Result::Unsupported;
+    }
+
+    ScopedBlock<uint8_t> buffer = Memory::Allocate<uint8_t>(size);
+
+    result = GetLogicalProcessorInformationEx(RelationAll, (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)&buffer, &size);
+    if (!result) {
+        System::Panic("GetLogicalProcessorInformationEx failed");
+    }
+
+    // only the first processor group fits into affinity masks
+    Collection::List<LogicalProcessor> processors;
+    for (uint32_t i = 0; i < 64; i++) {
+        processors.Append({ .index = i, .core = 0, .cacheGroup = 0, .package = 0 });
+    }
+
+    uint64_t present = 0;
+    uint32_t core = 0;
+    uint32_t cacheGroup = 0;
+    uint32_t package = 0;
+
+    for (DWORD offset = 0; offset < size;) {
+        const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* info = (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(&buffer + offset);
+        offset += info->Size;
+
+        switch (info->Relationship) {
+        case RelationProcessorCore: {
+            const GROUP_AFFINITY& affinity = info->Processor.GroupMask[0];
+            if (affinity.Group == 0) {
+                present |= affinity.Mask;
+
+                for (uint32_t i = 0; i < 64; i++) {
+                    if ((affinity.Mask & (1ull << i)) != 0) {
+                        processors[i].core = core;
+                    }
+                }
+            }
+
+            core++;
+            break;
+        }
+
+        case RelationProcessorPackage: {
+            for (WORD j = 0; j < info->Processor.GroupCount; j++) {
+                const GROUP_AFFINITY& affinity = info->Processor.GroupMask[j];
+                if (affinity.Group != 0) {
+                    continue;
+                }
+
+                for (uint32_t i = 0; i < 64; i++) {
+                    if ((affinity.Mask & (1ull << i)) != 0) {
+                        processors[i].package = package;
+                    }
+                }
+            }
+
+            package++;
+            break;
+        }
+
+        case RelationCache: {
+            if (info->Cache.Level != 3 || info->Cache.GroupMask.Group != 0) {
+                break;
+            }
+
+            for (uint32_t i = 0; i < 64; i++) {
+                if ((info->Cache.GroupMask.Mask & (1ull << i)) != 0) {
+                    processors[i].cacheGroup = cacheGroup;
+                }
+            }
+
+            cacheGroup++;
+            break;
+        }
+
+        default: {
+            break;
+        }
+        }
+    }
+
+    // drop the processors that don't exist, from the back so indices stay put
+    for (uint32_t i = 64; i > 0; i--) {
+        if ((present & (1ull << (i - 1))) == 0) {
+            processors.Remove(i - 1);
+        }
+    }
+
+    if (processors.IsEmpty()) {
+        return Result::Unsupported;
+    }
+
+    return new ProcessorTopology(processors);
+}
+
+}
@@ -2,11 +2,16 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/IO/File.hh>
+#include <Cell/System/Metrics.hh>
 
 #include <Foundation/Foundation.h>
 
 namespace Cell::IO {
 
+// Bytes moved through files, across all of them.
+static System::MetricCounter bytesRead("io.bytes_read");
+static System::MetricCounter bytesWritten("io.bytes_written");
+
 Result File::Read(Memory::IBlock& data) {
     NSFileHandle* handle = (NSFileHandle*)this->impl;
 
@@ -33,6 +38,7 @@ Result File::Read(Memory::IBlock& data) {
     }
 
     [nsData getBytes: data.AsPointer() length: data.GetSize()];
+    bytesRead.Add(nsData.length);
 
     return Result::Success;
 }
@@ -79,6 +85,8 @@ Result File::Write(const Memory::IBlock& data) {
     }
 
     CELL_ASSERT(result == YES);
+    bytesWritten.Add(data.GetSize());
+
     return Result::Success;
 }
 
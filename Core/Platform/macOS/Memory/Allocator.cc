@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/System/Panic.hh>
 
 #include <stdlib.h>
@@ -12,21 +13,58 @@ namespace Cell::Memory {
 void* Allocate(const size_t size) {
     CELL_ASSERT(size > 0);
 
-    void* buffer = calloc(1, size);
+    void* buffer = calloc(1, size + TrackingDetails::HeaderSize);
     CELL_ASSERT(buffer != nullptr);
 
-    return buffer;
+    return TrackingDetails::Track(buffer, size);
 }
 
-void Reallocate(void*& buffer, const size_t size) {
+void* AllocateUninitialized(const size_t size) {
     CELL_ASSERT(size > 0);
 
-    buffer = realloc(buffer, size);
+    void* buffer = malloc(size + TrackingDetails::HeaderSize);
     CELL_ASSERT(buffer != nullptr);
+
+    return TrackingDetails::Track(buffer, size);
+}
+
+void Reallocate(void*& buffer, const size_t size) {
+    CELL_ASSERT(size > 0);
+
+    void* base = realloc(TrackingDetails::Untrack(buffer), size + TrackingDetails::HeaderSize);
+    CELL_ASSERT(base != nullptr);
+
+    buffer = TrackingDetails::Retrack(base, size);
 }
 
 void Free(const void* buffer) {
-    free((void*)buffer);
+    free(TrackingDetails::Untrack(buffer));
+}
+
+void* AllocateAligned(const size_t size, const size_t alignment) {
+    CELL_ASSERT(size > 0 && alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    // posix_memalign requires at least pointer sized alignment
+    void* buffer = nullptr;
+    const int result = posix_memalign(&buffer, alignment < sizeof(void*) ? sizeof(void*) : alignment, size + TrackingDetails::GetPadding(alignment));
+    CELL_ASSERT(result == 0 && buffer != nullptr);
+
+    return TrackingDetails::Track(buffer, size, TrackingDetails::GetPadding(alignment));
+}
+
+void ReallocateAligned(void*& buffer, const size_t oldSize, const size_t size, const size_t alignment) {
+    CELL_ASSERT(size > 0);
+
+    // there's no aligned realloc, so the data has to be moved over manually
+    void* newBuffer = AllocateAligned(size, alignment);
+    memcpy(newBuffer, buffer, oldSize < size ? oldSize : size);
+    FreeAligned(buffer);
+
+    buffer = newBuffer;
+}
+
+void FreeAligned(const void* buffer) {
+    free(TrackingDetails::Untrack(buffer));
 }
 
 void Copy(void* destination, const void* source, const size_t size) {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Network/Socket.hh>
+#include <Cell/System/Metrics.hh>
 #include <Cell/System/Panic.hh>
 
 #include <errno.h>
@@ -9,6 +10,10 @@
 
 namespace Cell::Network {
 
+// Bytes moved through sockets, across all of them.
+static System::MetricCounter bytesSent("network.bytes_sent");
+static System::MetricCounter bytesReceived("network.bytes_received");
+
 Result Socket::Connect(const AddressInfo* info) {
     addrinfo* infoData = (addrinfo*)info->impl;
     const int result = connect((int)this->impl, infoData->ai_addr, infoData->ai_addrlen);
@@ -57,6 +62,8 @@ Result Socket::Send(const Memory::IBlock& data, const bool isOutOfBand) {
         }
         }
     }
+
+    bytesSent.Add((uint64_t)result);
     return Result::Success;
 }
 
@@ -78,6 +85,7 @@ Result Socket::Receive(Memory::IBlock& data) {
         }
     }
 
+    bytesReceived.Add((uint64_t)result);
     return Result::Success;
 }
 
@@ -17,7 +17,7 @@ wchar_t* String::ToPlatformWideString() const {
 }
 
 NSString* String::ToPlatformNSString() const {
-    return [[NSString alloc] initWithBytesNoCopy: (char*)this->data length: this->size encoding: NSUTF8StringEncoding freeWhenDone: NO];
+    return [[NSString alloc] initWithBytesNoCopy: (char*)this->GetData() length: this->size encoding: NSUTF8StringEncoding freeWhenDone: NO];
 }
 
 }
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Panic.hh>
+
+#include <errno.h>
+
+// the ulock interface isn't in the public headers, but it's what the system's own synchronization primitives are built on
+#define UL_COMPARE_AND_WAIT 1
+#define ULF_WAKE_ALL        0x00000100
+#define ULF_NO_ERRNO        0x01000000
+
+extern "C" int __ulock_wait(uint32_t operation, void* address, uint64_t value, uint32_t timeoutUs);
+extern "C" int __ulock_wake(uint32_t operation, void* address, uint64_t wakeValue);
+
+namespace Cell::System {
+
+Result FutexWait(const uint32_t* address, const uint32_t expected, const uint32_t timeoutMs) {
+    const uint32_t timeoutUs = timeoutMs > UINT32_MAX / 1000 ? UINT32_MAX : timeoutMs * 1000;
+
+    const int result = __ulock_wait(UL_COMPARE_AND_WAIT | ULF_NO_ERRNO, (void*)address, expected, timeoutUs);
+    if (result >= 0) {
+        return Result::Success;
+    }
+
+    switch (-result) {
+    case EINTR:
+    case EFAULT: {
+        return Result::Success;
+    }
+
+    case ETIMEDOUT: {
+        return Result::Timeout;
+    }
+
+    default: {
+        System::Panic("__ulock_wait failed");
+    }
+    }
+}
+
+void FutexWake(const uint32_t* address) {
+    // ENOENT only means nobody was waiting
+    __ulock_wake(UL_COMPARE_AND_WAIT | ULF_NO_ERRNO, (void*)address, 0);
+}
+
+void FutexWakeAll(const uint32_t* address) {
+    __ulock_wake(UL_COMPARE_AND_WAIT | ULF_WAKE_ALL | ULF_NO_ERRNO, (void*)address, 0);
+}
+
+}
@@ -14,6 +14,10 @@ uint64_t GetPreciseTickerValue() {
     return result / 1000;
 }
 
+uint64_t GetPreciseTickerNanoseconds() {
+    return clock_gettime_nsec_np(CLOCK_MONOTONIC);
+}
+
 void Sleep(const uint32_t milliseconds) {
     SleepPrecise(milliseconds * 1000);
 }
@@ -21,11 +25,19 @@ void Sleep(const uint32_t milliseconds) {
 void SleepPrecise(const uint64_t microseconds) {
     const struct timespec timeout = {
         .tv_sec  = (time_t)(microseconds / 1000000),
-        .tv_nsec = (time_t)(microseconds % 1000000)
+        .tv_nsec = (long)(microseconds % 1000000 * 1000)
     };
 
     /*const int result =*/ nanosleep(&timeout, nullptr);
     //CELL_ASSERT(result == 0);
 }
 
+void SleepUntil(const uint64_t deadline) {
+    // there's no absolute sleep on the monotonic clock
+    const uint64_t now = GetPreciseTickerValue();
+    if (now < deadline) {
+        SleepPrecise(deadline - now);
+    }
+}
+
 }
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Topology.hh>
+
+#include <sys/sysctl.h>
+
+namespace Cell::System {
+
+CELL_FUNCTION_INTERNAL uint32_t QueryCount(const char* name) {
+    int32_t value = 0;
+    size_t size = sizeof(value);
+
+    const int result = sysctlbyname(name, &value, &size, nullptr, 0);
+    if (result != 0 || value <= 0) {
+        return 0;
+    }
+
+    return (uint32_t)value;
+}
+
+Wrapped<ProcessorTopology*, Result> ProcessorTopology::Query() {
+    uint32_t logical = QueryCount("hw.logicalcpu");
+    uint32_t physical = QueryCount("hw.physicalcpu");
+    const uint32_t packages = QueryCount("hw.packages");
+
+    if (logical == 0 || physical == 0) {
+        return Result::Unsupported;
+    }
+
+    if (logical > 64) {
+        logical = 64;
+    }
+
+    // macOS doesn't expose which processors are siblings; they're numbered next to each other on Intel machines,
+    //  and there's no SMT on Apple silicon
+    const uint32_t siblings = logical > physical ? logical / physical : 1;
+    const uint32_t coresPerPackage = packages > 1 ? physical / packages : physical;
+
+    Collection::List<LogicalProcessor> processors;
+    for (uint32_t i = 0; i < logical; i++) {
+        const uint32_t core = i / siblings;
+
+        processors.Append({
+            .index      = i,
+            .core       = core,
+            .cacheGroup = 0,
+            .package    = coresPerPackage > 0 ? core / coresPerPackage : 0
+        });
+    }
+
+    return new ProcessorTopology(processors);
+}
+
+}
@@ -3,18 +3,30 @@
 
 #include <Cell/Cell.hh>
 #include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Slab.hh>
 #include <Cell/System/Panic.hh>
 
 namespace Cell {
 
 void* Object::operator new(size_t size) {
-    return Memory::Allocate(size);
+    return Memory::SlabAllocate(size);
 }
 
 void Object::operator delete(void* memory, size_t size) {
-    (void)(size);
+    Memory::SlabFree(memory, size);
+}
+
+void* Object::operator new(size_t size, std::align_val_t alignment) {
+    void* memory = Memory::AllocateAligned(size, (size_t)alignment);
+
+    // objects are zeroed, no matter where they come from
+    Memory::Clear(memory, size);
+    return memory;
+}
 
-    Memory::Free(memory);
+void Object::operator delete(void* memory, size_t size, std::align_val_t alignment) {
+    (void)(size); (void)(alignment);
+    Memory::FreeAligned(memory);
 }
 
 }
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Arena.hh>
+#include <Cell/System/Panic.hh>
+
+namespace Cell::Memory {
+
+Arena::Arena(const size_t chunkSize) : chunkSize(chunkSize) {
+    CELL_ASSERT(chunkSize > 0);
+}
+
+Arena::~Arena() {
+    Chunk* chunk = this->first;
+    while (chunk != nullptr) {
+        Chunk* next = chunk->next;
+        Memory::Free(chunk);
+        chunk = next;
+    }
+}
+
+void* Arena::Allocate(const size_t size, const size_t alignment) {
+    CELL_ASSERT(size > 0 && alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    while (true) {
+        if (this->current != nullptr) {
+            const uintptr_t base = (uintptr_t)this->GetChunkData(this->current);
+            const uintptr_t address = (base + this->offset + (alignment - 1)) & ~(uintptr_t)(alignment - 1);
+
+            if (address + size <= base + this->current->capacity) {
+                this->offset = address + size - base;
+                this->last = (void*)address;
+
+                return this->last;
+            }
+
+            // reuse chunks kept around from before a reset, as long as they're large enough
+            if (this->current->next != nullptr && this->current->next->capacity >= size + alignment) {
+                this->current = this->current->next;
+                this->offset = 0;
+                continue;
+            }
+        }
+
+        const size_t capacity = size + alignment > this->chunkSize ? size + alignment : this->chunkSize;
+
+        Chunk* chunk = (Chunk*)Memory::AllocateUninitialized(sizeof(Chunk) + capacity);
+        chunk->capacity = capacity;
+
+        if (this->current == nullptr) {
+            chunk->next = this->first;
+            this->first = chunk;
+        } else {
+            chunk->next = this->current->next;
+            this->current->next = chunk;
+        }
+
+        this->current = chunk;
+        this->offset = 0;
+    }
+}
+
+void* Arena::AllocateZeroed(const size_t size, const size_t alignment) {
+    void* block = this->Allocate(size, alignment);
+    Memory::Clear(block, size);
+
+    return block;
+}
+
+void Arena::Reallocate(void*& block, const size_t oldSize, const size_t size, const size_t alignment) {
+    CELL_ASSERT(size > 0);
+
+    if (block == this->last) {
+        const uintptr_t base = (uintptr_t)this->GetChunkData(this->current);
+        const size_t blockOffset = (uintptr_t)block - base;
+
+        if (blockOffset + size <= this->current->capacity) {
+            this->offset = blockOffset + size;
+            return;
+        }
+    }
+
+    void* newBlock = this->Allocate(size, alignment);
+    Memory::Copy(newBlock, block, oldSize < size ? oldSize : size);
+
+    block = newBlock;
+}
+
+void Arena::Free(const void* block) {
+    if (block != this->last) {
+        return;
+    }
+
+    this->offset = (uintptr_t)block - (uintptr_t)this->GetChunkData(this->current);
+    this->last = nullptr;
+}
+
+void Arena::Reset() {
+    this->current = this->first;
+    this->offset = 0;
+    this->last = nullptr;
+}
+
+Arena::Checkpoint Arena::GetCheckpoint() const {
+    return { this->current, this->offset };
+}
+
+void Arena::Rewind(const Checkpoint& checkpoint) {
+    if (checkpoint.chunk == nullptr) {
+        this->Reset();
+        return;
+    }
+
+    this->current = (Chunk*)checkpoint.chunk;
+    this->offset = checkpoint.offset;
+    this->last = nullptr;
+}
+
+}
@@ -0,0 +1,200 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Slab.hh>
+#include <Cell/Memory/Tracking.hh>
+#include <Cell/System/Panic.hh>
+
+namespace Cell::Memory {
+
+// Free blocks are linked together in batches, usually of BatchCount blocks. Only the first block of a batch uses nextBatch.
+struct FreeNode {
+    FreeNode* next;
+    FreeNode* nextBatch;
+};
+
+// Size classes, 16 byte steps up to 128, 32 byte steps up to 256 and 64 byte steps up to 512.
+constexpr size_t SizeClassCount = 16;
+constexpr size_t SlabSize = 65536;
+
+// Number of blocks moved between a thread cache and the central lists at once.
+constexpr size_t BatchCount = 32;
+
+CELL_STATIC_ASSERT(SlabSize / SlabMaximumSize >= BatchCount);
+
+// The central lists are stacks of batches, with their head pointer tagged by a counter in its upper 16 bits to avoid ABA issues.
+// This relies on user space addresses fitting in 48 bits.
+constexpr uint64_t TagShift = 48;
+constexpr uint64_t PointerMask = (1ull << TagShift) - 1;
+
+CELL_STATIC_ASSERT(sizeof(void*) == 8);
+
+struct ThreadCache {
+    FreeNode* head;
+    size_t count;
+};
+
+struct alignas(64) CentralList {
+    uint64_t head;
+};
+
+static thread_local ThreadCache threadCaches[SizeClassCount];
+static CentralList centralLists[SizeClassCount];
+
+CELL_FUNCTION_INTERNAL constexpr size_t GetSizeClass(const size_t size) {
+    if (size <= 128) {
+        return size <= 16 ? 0 : (size - 1) / 16;
+    }
+
+    if (size <= 256) {
+        return 8 + (size - 129) / 32;
+    }
+
+    return 12 + (size - 257) / 64;
+}
+
+CELL_FUNCTION_INTERNAL constexpr size_t GetClassSize(const size_t sizeClass) {
+    if (sizeClass < 8) {
+        return (sizeClass + 1) * 16;
+    }
+
+    if (sizeClass < 12) {
+        return 128 + (sizeClass - 7) * 32;
+    }
+
+    return 256 + (sizeClass - 11) * 64;
+}
+
+CELL_STATIC_ASSERT(GetSizeClass(SlabMaximumSize) == SizeClassCount - 1);
+CELL_STATIC_ASSERT(GetClassSize(SizeClassCount - 1) == SlabMaximumSize);
+
+CELL_FUNCTION_INTERNAL void PushBatch(CentralList& list, FreeNode* batch) {
+    uint64_t head = __atomic_load_n(&list.head, __ATOMIC_RELAXED);
+    uint64_t desired = 0;
+
+    do {
+        batch->nextBatch = (FreeNode*)(head & PointerMask);
+        desired = (uint64_t)batch | (((head >> TagShift) + 1) << TagShift);
+    } while (!__atomic_compare_exchange_n(&list.head, &head, desired, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+// Reading nextBatch of a batch another thread just took is harmless, as slab memory is never unmapped and the tag makes the exchange fail.
+CELL_FUNCTION_INTERNAL FreeNode* PopBatch(CentralList& list) {
+    uint64_t head = __atomic_load_n(&list.head, __ATOMIC_ACQUIRE);
+    uint64_t desired = 0;
+
+    FreeNode* batch = nullptr;
+    do {
+        batch = (FreeNode*)(head & PointerMask);
+        if (batch == nullptr) {
+            return nullptr;
+        }
+
+        desired = (uint64_t)batch->nextBatch | (((head >> TagShift) + 1) << TagShift);
+    } while (!__atomic_compare_exchange_n(&list.head, &head, desired, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+    return batch;
+}
+
+CELL_FUNCTION_INTERNAL void Refill(ThreadCache& cache, const size_t sizeClass) {
+    FreeNode* batch = PopBatch(centralLists[sizeClass]);
+    if (batch != nullptr) {
+        // batches released by exiting threads may hold any number of blocks
+        size_t count = 0;
+        for (FreeNode* node = batch; node != nullptr; node = node->next) {
+            count++;
+        }
+
+        cache.head = batch;
+        cache.count = count;
+        return;
+    }
+
+    // nothing left to share, carve up a fresh slab into full batches
+    // the first batch stays with this thread, the rest goes to the central list
+    const size_t classSize = GetClassSize(sizeClass);
+    const size_t count = (SlabSize / classSize) / BatchCount * BatchCount;
+
+    CELL_MEMORY_TAG(Slab);
+    uint8_t* slab = (uint8_t*)Memory::AllocateUninitialized(SlabSize);
+    for (size_t i = 0; i < count; i++) {
+        const bool endsBatch = (i + 1) % BatchCount == 0;
+        ((FreeNode*)(slab + i * classSize))->next = endsBatch ? nullptr : (FreeNode*)(slab + (i + 1) * classSize);
+    }
+
+    for (size_t i = BatchCount; i < count; i += BatchCount) {
+        PushBatch(centralLists[sizeClass], (FreeNode*)(slab + i * classSize));
+    }
+
+    cache.head = (FreeNode*)slab;
+    cache.count = BatchCount;
+}
+
+void* SlabAllocate(const size_t size) {
+    if (size > SlabMaximumSize) {
+        return Memory::Allocate(size);
+    }
+
+    const size_t sizeClass = GetSizeClass(size);
+
+    ThreadCache& cache = threadCaches[sizeClass];
+    if (cache.head == nullptr) {
+        Refill(cache, sizeClass);
+    }
+
+    FreeNode* node = cache.head;
+    cache.head = node->next;
+    cache.count--;
+
+    Memory::Clear((void*)node, GetClassSize(sizeClass));
+    return node;
+}
+
+void SlabFree(const void* block, const size_t size) {
+    if (size > SlabMaximumSize) {
+        Memory::Free(block);
+        return;
+    }
+
+    const size_t sizeClass = GetSizeClass(size);
+
+    ThreadCache& cache = threadCaches[sizeClass];
+
+    FreeNode* node = (FreeNode*)block;
+    node->next = cache.head;
+    cache.head = node;
+    cache.count++;
+
+    if (cache.count < BatchCount * 2) {
+        return;
+    }
+
+    // hand the oldest batch over to other threads, keeping the most recently freed blocks local
+    FreeNode* last = cache.head;
+    for (size_t i = 1; i < BatchCount; i++) {
+        last = last->next;
+    }
+
+    FreeNode* batch = last->next;
+    last->next = nullptr;
+    cache.count = BatchCount;
+
+    PushBatch(centralLists[sizeClass], batch);
+}
+
+void SlabReleaseThreadCache() {
+    for (size_t sizeClass = 0; sizeClass < SizeClassCount; sizeClass++) {
+        ThreadCache& cache = threadCaches[sizeClass];
+        if (cache.head == nullptr) {
+            continue;
+        }
+
+        PushBatch(centralLists[sizeClass], cache.head);
+
+        cache.head = nullptr;
+        cache.count = 0;
+    }
+}
+
+}
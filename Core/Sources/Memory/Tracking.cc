@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Memory/Tracking.hh>
+
+#ifdef CELL_CORE_MEMORY_TRACKING
+
+#include <Cell/System/Log.hh>
+#include <Cell/System/Timer.hh>
+
+namespace Cell::Memory {
+
+struct BlockHeader {
+    uint64_t size;
+    uint32_t offset;
+    Tag tag;
+};
+
+CELL_STATIC_ASSERT(sizeof(BlockHeader) <= TrackingDetails::HeaderSize);
+
+// Counters of a single thread. Blocks freed by another thread than the one that allocated them make single counters go negative,
+// only their sum across all threads is meaningful.
+// Peaks are the highest live bytes of this thread's counters within the current sampling period, which started over once the thread
+//  noticed a new generation.
+struct alignas(64) ThreadCounters {
+    int64_t liveBytes[TagCount];
+    int64_t liveBlocks[TagCount];
+    uint64_t allocatedBytes[TagCount];
+    uint64_t allocations[TagCount];
+    int64_t peakBytes[TagCount];
+    uint64_t generation;
+};
+
+// Threads past the first ThreadCounterCount - 1 all share the last set of counters.
+constexpr uint32_t ThreadCounterCount = 64;
+
+static ThreadCounters threadCounters[ThreadCounterCount];
+static uint32_t threadCountersUsed = 0;
+
+// Sampling period, bumped by every sample; only ever read by allocating threads.
+static uint64_t sampleGeneration = 1;
+
+static thread_local uint32_t threadCounterIndex = 0;
+static thread_local Tag currentTag = Tag::General;
+
+struct SampleState {
+    TagStatistics statistics[TagCount];
+
+    uint64_t lastAllocatedBytes[TagCount];
+    uint64_t lastAllocations[TagCount];
+    uint64_t lastTime;
+
+    bool locked;
+};
+
+static SampleState sampleState;
+
+CELL_FUNCTION_INTERNAL ThreadCounters& GetThreadCounters(bool& shared) {
+    if (threadCounterIndex == 0) {
+        const uint32_t index = __atomic_fetch_add(&threadCountersUsed, 1, __ATOMIC_RELAXED);
+        threadCounterIndex = (index < ThreadCounterCount ? index : ThreadCounterCount - 1) + 1;
+    }
+
+    shared = threadCounterIndex == ThreadCounterCount;
+    return threadCounters[threadCounterIndex - 1];
+}
+
+// Counters are only written by their owning thread, unless shared; sampling threads merely read them.
+template <typename T> CELL_FUNCTION_INTERNAL void AddToCounter(T& counter, const T value, const bool shared) {
+    if (shared) {
+        __atomic_fetch_add(&counter, value, __ATOMIC_RELAXED);
+        return;
+    }
+
+    __atomic_store_n(&counter, __atomic_load_n(&counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+// Starts the peaks of this thread over from its live bytes if a sample was taken since it last counted anything.
+// Threads sharing counters may race on this, which can only make peaks a little less precise.
+CELL_FUNCTION_INTERNAL void StartPeakPeriod(ThreadCounters& counters) {
+    const uint64_t generation = __atomic_load_n(&sampleGeneration, __ATOMIC_RELAXED);
+    if (__atomic_load_n(&counters.generation, __ATOMIC_RELAXED) == generation) {
+        return;
+    }
+
+    for (size_t tag = 0; tag < TagCount; tag++) {
+        __atomic_store_n(&counters.peakBytes[tag], __atomic_load_n(&counters.liveBytes[tag], __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&counters.generation, generation, __ATOMIC_RELAXED);
+}
+
+CELL_FUNCTION_INTERNAL void CountLiveBytes(ThreadCounters& counters, const Tag tag, const size_t size, const bool shared) {
+    AddToCounter<int64_t>(counters.liveBytes[(size_t)tag], (int64_t)size, shared);
+    AddToCounter<int64_t>(counters.liveBlocks[(size_t)tag], 1, shared);
+
+    const int64_t live = __atomic_load_n(&counters.liveBytes[(size_t)tag], __ATOMIC_RELAXED);
+    if (live > __atomic_load_n(&counters.peakBytes[(size_t)tag], __ATOMIC_RELAXED)) {
+        __atomic_store_n(&counters.peakBytes[(size_t)tag], live, __ATOMIC_RELAXED);
+    }
+}
+
+CELL_FUNCTION_INTERNAL void CountAllocation(const Tag tag, const size_t size) {
+    bool shared = false;
+    ThreadCounters& counters = GetThreadCounters(shared);
+    StartPeakPeriod(counters);
+
+    CountLiveBytes(counters, tag, size, shared);
+    AddToCounter<uint64_t>(counters.allocatedBytes[(size_t)tag], size, shared);
+    AddToCounter<uint64_t>(counters.allocations[(size_t)tag], 1, shared);
+}
+
+// Counts a block that was reallocated, and untracked beforehand, as live again without counting another allocation.
+CELL_FUNCTION_INTERNAL void CountReallocation(const Tag tag, const size_t size) {
+    bool shared = false;
+    ThreadCounters& counters = GetThreadCounters(shared);
+    StartPeakPeriod(counters);
+
+    CountLiveBytes(counters, tag, size, shared);
+}
+
+CELL_FUNCTION_INTERNAL void CountFree(const Tag tag, const size_t size) {
+    bool shared = false;
+    ThreadCounters& counters = GetThreadCounters(shared);
+    StartPeakPeriod(counters);
+
+    AddToCounter<int64_t>(counters.liveBytes[(size_t)tag], -(int64_t)size, shared);
+    AddToCounter<int64_t>(counters.liveBlocks[(size_t)tag], -1, shared);
+}
+
+CELL_FUNCTION_INTERNAL BlockHeader* GetHeader(const void* block) {
+    return (BlockHeader*)((uintptr_t)block - TrackingDetails::HeaderSize);
+}
+
+Tag GetCurrentTag() {
+    return currentTag;
+}
+
+Tag SetCurrentTag(const Tag tag) {
+    const Tag previous = currentTag;
+    currentTag = tag;
+
+    return previous;
+}
+
+const char* GetTagName(const Tag tag) {
+    switch (tag) {
+    case Tag::General: {
+        return "General";
+    }
+
+    case Tag::Collection: {
+        return "Collection";
+    }
+
+    case Tag::String: {
+        return "String";
+    }
+
+    case Tag::Slab: {
+        return "Slab";
+    }
+
+    case Tag::Atom: {
+        return "Atom";
+    }
+
+    case Tag::Shell: {
+        return "Shell";
+    }
+
+    case Tag::DataManagement: {
+        return "DataManagement";
+    }
+
+    case Tag::Renderer: {
+        return "Renderer";
+    }
+
+    case Tag::Audio: {
+        return "Audio";
+    }
+
+    case Tag::OpenXR: {
+        return "OpenXR";
+    }
+
+    case Tag::Network: {
+        return "Network";
+    }
+
+    default: {
+        return "Unknown";
+    }
+    }
+}
+
+void SampleTracking() {
+    while (__atomic_test_and_set(&sampleState.locked, __ATOMIC_ACQUIRE)) { }
+
+    const uint32_t used = __atomic_load_n(&threadCountersUsed, __ATOMIC_RELAXED);
+    const uint32_t count = used < ThreadCounterCount ? used : ThreadCounterCount;
+
+    const uint64_t time = System::GetPreciseTickerValue();
+    const uint64_t elapsed = time - sampleState.lastTime;
+
+    for (size_t tag = 0; tag < TagCount; tag++) {
+        int64_t liveBytes = 0;
+        int64_t liveBlocks = 0;
+        uint64_t allocatedBytes = 0;
+        uint64_t allocations = 0;
+        int64_t peakBytes = 0;
+
+        for (uint32_t i = 0; i < count; i++) {
+            const int64_t threadLiveBytes = __atomic_load_n(&threadCounters[i].liveBytes[tag], __ATOMIC_RELAXED);
+
+            // threads that haven't counted anything during this period haven't changed since its start
+            const bool current = __atomic_load_n(&threadCounters[i].generation, __ATOMIC_RELAXED) == sampleGeneration;
+            peakBytes += current ? __atomic_load_n(&threadCounters[i].peakBytes[tag], __ATOMIC_RELAXED) : threadLiveBytes;
+
+            liveBytes += threadLiveBytes;
+            liveBlocks += __atomic_load_n(&threadCounters[i].liveBlocks[tag], __ATOMIC_RELAXED);
+            allocatedBytes += __atomic_load_n(&threadCounters[i].allocatedBytes[tag], __ATOMIC_RELAXED);
+            allocations += __atomic_load_n(&threadCounters[i].allocations[tag], __ATOMIC_RELAXED);
+        }
+
+        TagStatistics& statistics = sampleState.statistics[tag];
+
+        // counters of different threads are read at slightly different times, which may briefly show frees before their allocations
+        statistics.liveBytes = liveBytes > 0 ? (size_t)liveBytes : 0;
+        statistics.liveBlocks = liveBlocks > 0 ? (size_t)liveBlocks : 0;
+        statistics.allocations = allocations;
+
+        // the sum of every thread's own peak can only be higher than the actual one, when the threads peaked at different times
+        if (peakBytes < liveBytes) {
+            peakBytes = liveBytes;
+        }
+
+        if (peakBytes > 0 && (size_t)peakBytes > statistics.peakBytes) {
+            statistics.peakBytes = (size_t)peakBytes;
+        }
+
+        if (sampleState.lastTime != 0 && elapsed > 0) {
+            statistics.bytesPerSecond = (allocatedBytes - sampleState.lastAllocatedBytes[tag]) * 1000000 / elapsed;
+            statistics.allocationsPerSecond = (allocations - sampleState.lastAllocations[tag]) * 1000000 / elapsed;
+        }
+
+        sampleState.lastAllocatedBytes[tag] = allocatedBytes;
+        sampleState.lastAllocations[tag] = allocations;
+    }
+
+    sampleState.lastTime = time;
+    __atomic_store_n(&sampleGeneration, sampleGeneration + 1, __ATOMIC_RELAXED);
+
+    __atomic_clear(&sampleState.locked, __ATOMIC_RELEASE);
+}
+
+TagStatistics GetTagStatistics(const Tag tag) {
+    CELL_ASSERT((size_t)tag < TagCount);
+
+    while (__atomic_test_and_set(&sampleState.locked, __ATOMIC_ACQUIRE)) { }
+    const TagStatistics statistics = sampleState.statistics[(size_t)tag];
+    __atomic_clear(&sampleState.locked, __ATOMIC_RELEASE);
+
+    return statistics;
+}
+
+void ReportLeaks() {
+    SampleTracking();
+
+    // take a copy first, as logging allocates as well
+    TagStatistics statistics[TagCount];
+    for (size_t tag = 0; tag < TagCount; tag++) {
+        statistics[tag] = GetTagStatistics((Tag)tag);
+    }
+
+    bool leaked = false;
+    for (size_t tag = 0; tag < TagCount; tag++) {
+        if (statistics[tag].liveBlocks == 0) {
+            continue;
+        }
+
+        // slabs are kept around for reuse on purpose
+        if ((Tag)tag == Tag::Slab) {
+            System::Log("Memory: % bytes retained by slabs (peak % bytes)", (uint64_t)statistics[tag].liveBytes, (uint64_t)statistics[tag].peakBytes);
+            continue;
+        }
+
+        // interned text is kept for the lifetime of the program by design
+        if ((Tag)tag == Tag::Atom) {
+            System::Log("Memory: % bytes retained by the atom table", (uint64_t)statistics[tag].liveBytes);
+            continue;
+        }
+
+        System::Log("Memory: % leaked % bytes in % blocks (peak % bytes, % allocations total)",
+                    GetTagName((Tag)tag),
+                    (uint64_t)statistics[tag].liveBytes,
+                    (uint64_t)statistics[tag].liveBlocks,
+                    (uint64_t)statistics[tag].peakBytes,
+                    statistics[tag].allocations);
+
+        leaked = true;
+    }
+
+    if (!leaked) {
+        System::Log("Memory: no leaks found");
+    }
+}
+
+}
+
+namespace Cell::Memory::TrackingDetails {
+
+void* Track(void* base, const size_t size, const size_t offset) {
+    void* block = (uint8_t*)base + offset;
+
+    BlockHeader* header = GetHeader(block);
+    header->size = size;
+    header->offset = (uint32_t)offset;
+    header->tag = currentTag;
+
+    CountAllocation(header->tag, size);
+    return block;
+}
+
+void* Retrack(void* base, const size_t size, const size_t offset) {
+    void* block = (uint8_t*)base + offset;
+
+    BlockHeader* header = GetHeader(block);
+    header->size = size;
+
+    CountReallocation(header->tag, size);
+    return block;
+}
+
+void* Untrack(const void* block) {
+    if (block == nullptr) {
+        return nullptr;
+    }
+
+    BlockHeader* header = GetHeader(block);
+    CountFree(header->tag, header->size);
+
+    return (uint8_t*)block - header->offset;
+}
+
+}
+
+#endif
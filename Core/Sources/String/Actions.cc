@@ -10,50 +10,28 @@ namespace Cell {
 using namespace Memory;
 using namespace StringDetails;
 
-Result String::Append(const String& string) {
-    if (string.IsEmpty()) {
+Result String::Append(const StringView text) {
+    if (text.IsEmpty()) {
         return Result::IsEmpty;
     }
 
-    if (this->size == 0) {
-        this->data = Allocate<char>(string.size);
-    } else {
-        Reallocate<char>(this->data, this->size + string.size);
-    }
-
-    Copy<char>(this->data + this->size, string.data, string.size);
-
-    this->size += string.size;
+    this->AppendData(text.ToRawPointer(), text.GetSize());
     return Result::Success;
 }
 
 Result String::Append(const char* input) {
-    const size_t dataSize = StringDetails::RawStringSize(input);
-    if (dataSize == 0) {
-        return Result::Success;
-    }
-
-    if (this->size == 0) {
-        this->data = Allocate<char>(dataSize);
-    } else {
-        Reallocate<char>(this->data, this->size + dataSize);
-    }
-
-    Copy<char>(this->data + this->size, input, dataSize);
-    this->size += dataSize;
-
+    this->AppendData(input, StringDetails::RawStringSize(input));
     return Result::Success;
 }
 
 void String::Clear() {
-    if (this->size == 0) {
-        return;
-    }
-
-    Free(this->data);
-
     this->size = 0;
-    this->data = nullptr;
+}
+
+void String::Reserve(const size_t capacity) {
+    if (capacity > this->capacity) {
+        this->SetCapacity(capacity);
+    }
 }
 
 Wrapped<String, Result> String::Substring(const size_t offset, const size_t length) const {
@@ -61,7 +39,10 @@ Wrapped<String, Result> String::Substring(const size_t offset, const size_t leng
         return Result::InvalidParameters;
     }
 
-    return String(this->data + offset, length);
+    String output;
+    output.AppendData(this->GetData() + offset, length);
+
+    return output;
 }
 
 }
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Atom.hh>
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/Memory/Arena.hh>
+#include <Cell/Memory/Tracking.hh>
+#include <Cell/System/Mutex.hh>
+
+namespace Cell {
+using namespace System;
+
+// Atoms are stored in chunks of this many, which never move once allocated.
+constexpr uint32_t ChunkBits = 10;
+constexpr uint32_t ChunkSize = 1 << ChunkBits;
+
+// Largest number of chunks; this caps the number of distinct atoms at a little over four million.
+constexpr uint32_t MaxChunks = 4096;
+
+// Number of slots the index starts out with. It's kept at most half full, doubling as needed.
+constexpr uint32_t MinimumSlotCount = 1024;
+
+struct AtomEntry {
+    const char* text;
+    uint32_t size;
+    uint32_t hash;
+};
+
+// Open addressing index from text to atoms, probed linearly.
+// Every slot holds the hash of the text in its upper half and the ID in its lower one, so that probing rarely has to look at the text itself.
+struct AtomIndex {
+    uint64_t* slots;
+    uint32_t mask;
+};
+
+// Readers never lock: entries are filled in before their slot gets published, and neither chunks nor replaced indices are ever freed.
+// Everything else is only touched with the lock held.
+static AtomEntry* chunks[MaxChunks] = { };
+static AtomIndex* currentIndex = nullptr;
+
+static Mutex lock;
+static Memory::Arena* storage = nullptr;
+static uint32_t nextId = 1;
+
+CELL_FUNCTION_INTERNAL const AtomEntry& GetEntry(const uint32_t id) {
+    const AtomEntry* chunk = __atomic_load_n(&chunks[id >> ChunkBits], __ATOMIC_ACQUIRE);
+    return chunk[id & (ChunkSize - 1)];
+}
+
+// Returns the ID of the given text within the index, or 0 if it's not part of it.
+CELL_FUNCTION_INTERNAL uint32_t Search(const AtomIndex* index, const StringView text, const uint32_t hash) {
+    if (index == nullptr) {
+        return 0;
+    }
+
+    for (uint32_t slot = hash & index->mask;; slot = (slot + 1) & index->mask) {
+        const uint64_t value = __atomic_load_n(&index->slots[slot], __ATOMIC_ACQUIRE);
+        if (value == 0) {
+            return 0;
+        }
+
+        if ((uint32_t)(value >> 32) != hash) {
+            continue;
+        }
+
+        const AtomEntry& entry = GetEntry((uint32_t)value);
+        if (StringView(entry.text, entry.size) == text) {
+            return (uint32_t)value;
+        }
+    }
+}
+
+CELL_FUNCTION_INTERNAL void Insert(AtomIndex* index, const uint32_t hash, const uint32_t id) {
+    uint32_t slot = hash & index->mask;
+    while (index->slots[slot] != 0) {
+        slot = (slot + 1) & index->mask;
+    }
+
+    __atomic_store_n(&index->slots[slot], ((uint64_t)hash << 32) | id, __ATOMIC_RELEASE);
+}
+
+// Replaces the index with one twice its size. The old one is left alone, as readers may still be searching it.
+CELL_FUNCTION_INTERNAL void Grow() {
+    const uint32_t slotCount = currentIndex == nullptr ? MinimumSlotCount : (currentIndex->mask + 1) * 2;
+
+    AtomIndex* index = storage->Allocate<AtomIndex>();
+    index->slots = storage->AllocateZeroed<uint64_t>(slotCount);
+    index->mask = slotCount - 1;
+
+    for (uint32_t id = 1; id < nextId; id++) {
+        Insert(index, GetEntry(id).hash, id);
+    }
+
+    __atomic_store_n(&currentIndex, index, __ATOMIC_RELEASE);
+}
+
+CELL_FUNCTION_INTERNAL uint32_t Add(const StringView text, const uint32_t hash) {
+    const uint32_t id = nextId;
+    if (id >> ChunkBits >= MaxChunks) {
+        Panic("Too many atoms");
+    }
+
+    CELL_ASSERT(text.GetSize() <= UINT32_MAX);
+
+    if (storage == nullptr) {
+        storage = new Memory::Arena();
+    }
+
+    AtomEntry* chunk = chunks[id >> ChunkBits];
+    if (chunk == nullptr) {
+        chunk = storage->Allocate<AtomEntry>(ChunkSize);
+        __atomic_store_n(&chunks[id >> ChunkBits], chunk, __ATOMIC_RELEASE);
+    }
+
+    char* copy = (char*)storage->Allocate(text.GetSize(), 1);
+    Memory::Copy<char>(copy, text.ToRawPointer(), text.GetSize());
+
+    chunk[id & (ChunkSize - 1)] = { .text = copy, .size = (uint32_t)text.GetSize(), .hash = hash };
+
+    if (currentIndex == nullptr || (uint64_t)id * 2 > (uint64_t)currentIndex->mask + 1) {
+        Grow();
+    }
+
+    Insert(currentIndex, hash, id);
+    nextId++;
+
+    return id;
+}
+
+Atom Atom::Intern(const StringView text) {
+    return Intern(text, ComputeHash(text));
+}
+
+Atom Atom::Intern(const StringView text, const uint32_t hash) {
+    if (text.IsEmpty()) {
+        return Atom();
+    }
+
+    uint32_t id = Search(__atomic_load_n(&currentIndex, __ATOMIC_ACQUIRE), text, hash);
+    if (id != 0) {
+        return Atom(id);
+    }
+
+    CELL_MEMORY_TAG(Atom);
+    lock.Lock();
+
+    // another thread may have interned the same text in the meantime
+    id = Search(currentIndex, text, hash);
+    if (id == 0) {
+#ifndef CELL_CORE_SKIP_ASSERT
+        // a wrong hash never finds its text, so checking it here, only for new text, catches it as well
+        CELL_ASSERT(hash == ComputeHash(text));
+#endif
+
+        id = Add(text, hash);
+    }
+
+    lock.Unlock();
+    return Atom(id);
+}
+
+Optional<Atom> Atom::Find(const StringView text) {
+    if (text.IsEmpty()) {
+        return Atom();
+    }
+
+    const uint32_t id = Search(__atomic_load_n(&currentIndex, __ATOMIC_ACQUIRE), text, ComputeHash(text));
+    if (id == 0) {
+        return None<Atom>();
+    }
+
+    return Atom(id);
+}
+
+StringView Atom::GetText() const {
+    if (this->id == 0) {
+        return StringView();
+    }
+
+    const AtomEntry& entry = GetEntry(this->id);
+    return StringView(entry.text, entry.size);
+}
+
+uint32_t Atom::GetHash() const {
+    if (this->id == 0) {
+        return ComputeHash(StringView());
+    }
+
+    return GetEntry(this->id).hash;
+}
+
+}
@@ -10,6 +10,10 @@ size_t String::GetSize() const {
     return this->size;
 }
 
+size_t String::GetCapacity() const {
+    return this->capacity;
+}
+
 size_t String::GetCount() const {
     return this->size; // TODO: actually calculate the number of characters
 }
@@ -18,20 +22,12 @@ bool String::IsEmpty() const {
     return this->size == 0;
 }
 
-bool String::BeginsWith(const String& substring) const {
-    if (substring.size >= this->size) {
-        return false;
-    }
-
-    return Memory::Compare(this->data, substring.data, substring.size);
+bool String::BeginsWith(const StringView text) const {
+    return StringView(*this).BeginsWith(text);
 }
 
-bool String::EndsWith(const String& substring) const {
-    if (substring.size >= this->size) {
-        return false;
-    }
-
-    return Memory::Compare(this->data + (this->size - substring.size), substring.data, substring.size);
+bool String::EndsWith(const StringView text) const {
+    return StringView(*this).EndsWith(text);
 }
 
 }
@@ -3,6 +3,8 @@
 
 #include <Cell/Scoped.hh>
 #include <Cell/String.hh>
+#include <Cell/Memory/Arena.hh>
+#include <Cell/Memory/Tracking.hh>
 
 #include <string.h>
 
@@ -10,31 +12,123 @@ namespace Cell {
 using namespace StringDetails;
 using namespace Memory;
 
-String::String() : data(nullptr), size(0) { }
+String::String() { }
 
-String::String(const char* CELL_NONNULL utf8, const size_t length) : data(nullptr), size(length) {
-    if (length == 0) {
-        this->size = strlen(utf8);
-        if (this->size == 0) {
-            return; // empty
-        }
-    }
+String::String(const char* CELL_NONNULL utf8, const size_t length) {
+    this->AssignData(utf8, length == 0 ? strlen(utf8) : length);
+}
+
+String::String(Arena& arena) : arena(&arena) { }
 
-    this->data = Allocate<char>(this->size);
-    Copy<char>(this->data, utf8, this->size);
+String::String(Arena& arena, const char* CELL_NONNULL utf8, const size_t length) : arena(&arena) {
+    this->AssignData(utf8, length == 0 ? strlen(utf8) : length);
 }
 
-String::String(const String& string) : data(nullptr), size(string.size) {
-    if (string.size > 0) {
-        this->data = Allocate<char>(string.size);
-        Copy<char>(this->data, string.data, string.size);
+String::String(const String& string) {
+    this->AssignData(string.GetData(), string.size);
+}
+
+String::String(const StringView view) {
+    this->AssignData(view.ToRawPointer(), view.GetSize());
+}
+
+String::String(String&& string) {
+    if (string.IsInline() || string.arena != nullptr) {
+        this->AssignData(string.GetData(), string.size);
+        string.size = 0;
+        return;
     }
+
+    this->data = string.data;
+    this->size = string.size;
+    this->capacity = string.capacity;
+
+    string.size = 0;
+    string.capacity = InlineCapacity;
 }
 
 String::~String() {
-    if (this->size > 0) {
+    this->FreeData();
+}
+
+void String::AssignData(const char* data, const size_t size) {
+    this->size = 0;
+    this->Grow(size);
+
+    Copy<char>(this->GetData(), data, size);
+    this->size = size;
+}
+
+void String::AppendData(const char* data, const size_t size) {
+    if (size == 0) {
+        return;
+    }
+
+    // the data may be part of this string, which growing could move elsewhere
+    const uintptr_t start = (uintptr_t)this->GetData();
+    const bool isOwnData = (uintptr_t)data >= start && (uintptr_t)data < start + this->size;
+    const size_t offset = (uintptr_t)data - start;
+
+    this->Grow(this->size + size);
+
+    Copy<char>(this->GetData() + this->size, isOwnData ? this->GetData() + offset : data, size);
+    this->size += size;
+}
+
+void String::Grow(const size_t size) {
+    if (size <= this->capacity) {
+        return;
+    }
+
+    this->SetCapacity(this->capacity * 2 > size ? this->capacity * 2 : size);
+}
+
+void String::SetCapacity(const size_t capacity) {
+    CELL_ASSERT(capacity > InlineCapacity && capacity >= this->size);
+
+    if (this->IsInline()) {
+        char* block = this->AllocateData(capacity);
+        Copy<char>(block, this->inlineData, this->size);
+
+        this->data = block;
+    } else {
+        this->ReallocateData(capacity);
+    }
+
+    this->capacity = capacity;
+}
+
+char* String::AllocateData(const size_t size) {
+    if (this->arena != nullptr) {
+        return this->arena->Allocate<char>(size);
+    }
+
+    CELL_MEMORY_FALLBACK_TAG(String);
+    return AllocateUninitialized<char>(size);
+}
+
+void String::ReallocateData(const size_t size) {
+    if (this->arena != nullptr) {
+        this->arena->Reallocate<char>(this->data, this->capacity, size);
+        return;
+    }
+
+    CELL_MEMORY_FALLBACK_TAG(String);
+    Reallocate<char>(this->data, size);
+}
+
+void String::FreeData() {
+    if (this->IsInline()) {
+        return;
+    }
+
+    if (this->arena != nullptr) {
+        this->arena->Free(this->data);
+    } else {
         Free(this->data);
     }
+
+    this->capacity = InlineCapacity;
 }
 
 }
@@ -3,73 +3,224 @@
 
 #include <Cell/Scoped.hh>
 #include <Cell/String.hh>
+#include <Cell/Memory/Construct.hh>
+#include <Cell/StringDetails/Numbers.hh>
 
 #include <string.h>
-#include <stdio.h>
 
 namespace Cell {
+using namespace StringDetails;
 using namespace StringDetails::Formatting;
 
-String String::FormatImplementation(const char* format, const size_t length, const Data* content, const size_t count) {
-    String output;
+// Size of formatted addresses, "0x" and 16 hexadecimal digits.
+constexpr size_t AddressSize = 18;
+
+CELL_FUNCTION_INTERNAL void WriteAddress(char* output, const void* address) {
+    const char* hexDigits = "0123456789abcdef";
+
+    output[0] = '0';
+    output[1] = 'x';
+
+    uint64_t value = (uint64_t)(uintptr_t)address;
+    for (size_t i = AddressSize; i > 2; i--) {
+        output[i - 1] = hexDigits[value & 0xf];
+        value >>= 4;
+    }
+}
+
+// Size of an argument once formatted. Floating point numbers and wide strings are converted while measuring already, and only copied when writing.
+// This is left uninitialized, so that formatting doesn't pay for it; the converted string is only constructed for wide string arguments.
+struct MeasuredArgument {
+    size_t size;
+
+    union {
+        char number[MaxNumberSize];
+        alignas(String) uint8_t converted[sizeof(String)];
+    };
+
+    CELL_FUNCTION_INTERNAL String& GetConverted() {
+        return *(String*)this->converted;
+    }
+
+    CELL_FUNCTION_INTERNAL const String& GetConverted() const {
+        return *(const String*)this->converted;
+    }
+};
+
+// Returns the number of bytes the given argument takes up once formatted.
+CELL_FUNCTION_INTERNAL size_t MeasureArgument(const Data& argument, MeasuredArgument& measured) {
+    switch (argument.type) {
+    case Type::Int: {
+        const uint64_t magnitude = argument.sInt < 0 ? 0 - (uint64_t)argument.sInt : (uint64_t)argument.sInt;
+        return CountDigits(magnitude) + (argument.sInt < 0 ? 1 : 0);
+    }
+
+    case Type::UInt: {
+        return CountDigits(argument.uInt);
+    }
+
+    case Type::ConstCharPointer: {
+        return strlen(argument.constCharPointer);
+    }
+
+    case Type::ConstWideCharPointer: {
+        Memory::Construct<String>(&measured.GetConverted(), String::FromPlatformWideString(argument.constWideCharPointer).Unwrap());
+        return measured.GetConverted().GetSize();
+    }
+
+    case Type::Address: {
+        return AddressSize;
+    }
+
+    case Type::CellString: {
+        return argument.string.Unwrap().GetSize();
+    }
+
+    case Type::CellStringView: {
+        return argument.view.size;
+    }
+
+    case Type::FloatingPoint: {
+        return FormatDouble(measured.number, argument.floatingPoint);
+    }
+
+    case Type::SingleFloatingPoint: {
+        return FormatFloat(measured.number, (float)argument.floatingPoint);
+    }
+    }
+
+    CELL_UNREACHABLE;
+}
+
+// Writes the given argument, which takes up exactly the measured size.
+CELL_FUNCTION_INTERNAL void WriteArgument(char* output, const Data& argument, const MeasuredArgument& measured) {
+    const size_t size = measured.size;
+
+    switch (argument.type) {
+    case Type::Int: {
+        FormatSigned(output, argument.sInt);
+        break;
+    }
+
+    case Type::UInt: {
+        FormatUnsigned(output, argument.uInt);
+        break;
+    }
+
+    case Type::ConstCharPointer: {
+        Memory::Copy<char>(output, argument.constCharPointer, size);
+        break;
+    }
+
+    case Type::ConstWideCharPointer: {
+        Memory::Copy<char>(output, measured.GetConverted().ToRawPointer(), size);
+        break;
+    }
+
+    case Type::Address: {
+        WriteAddress(output, argument.address);
+        break;
+    }
+
+    case Type::CellString: {
+        Memory::Copy<char>(output, argument.string.Unwrap().ToRawPointer(), size);
+        break;
+    }
+
+    case Type::CellStringView: {
+        Memory::Copy<char>(output, argument.view.text, size);
+        break;
+    }
+
+    case Type::FloatingPoint:
+    case Type::SingleFloatingPoint: {
+        Memory::Copy<char>(output, measured.number, size);
+        break;
+    }
+    }
+}
+
+// Measures all arguments, and returns the size of the whole formatted text.
+CELL_FUNCTION_INTERNAL size_t MeasureFormat(const size_t length, const Data* content, const size_t count, MeasuredArgument* measured) {
+    // every placeholder is replaced by its argument
+    size_t total = length - count;
+    for (size_t i = 0; i < count; i++) {
+        measured[i].size = MeasureArgument(content[i], measured[i]);
+        total += measured[i].size;
+    }
+
+    return total;
+}
+
+// Destructs what measuring the arguments constructed.
+CELL_FUNCTION_INTERNAL void ReleaseMeasurements(const Data* content, const size_t count, MeasuredArgument* measured) {
+    for (size_t i = 0; i < count; i++) {
+        if (content[i].type == Type::ConstWideCharPointer) {
+            Memory::Destruct<String>(&measured[i].GetConverted());
+        }
+    }
+}
 
-    size_t insertedArgumentCount = 0;
-    for (size_t formatCharacterIndex = 0; formatCharacterIndex < length; formatCharacterIndex++) {
-        if (format[formatCharacterIndex] == '%') {
-            // if you manage to have larger digits, may God help you.
-            char buf[200] = { 0};
-
-            switch (content[insertedArgumentCount].type) {
-            case Type::Int: {
-                snprintf(buf, 200, "%lld", content[insertedArgumentCount].sInt);
-                output += buf;
-                break;
-            }
-
-            case Type::UInt: {
-                snprintf(buf, 200, "%llu", content[insertedArgumentCount].uInt);
-                output += buf;
-                break;
-            }
-
-            case Type::ConstCharPointer: {
-                output += content[insertedArgumentCount].constCharPointer;
-                break;
-            }
-
-            case Type::ConstWideCharPointer: {
-                output += String::FromPlatformWideString(content[insertedArgumentCount].constWideCharPointer).Unwrap();
-                break;
-            }
-
-            case Type::Address: {
-                // Avoids a formatting error, I hate C types so much
-                snprintf(buf, 200, "0x%016llx", (unsigned long long)(content[insertedArgumentCount].address));
-                output += buf;
-                break;
-            }
-
-            case Type::CellString: {
-                output += content[insertedArgumentCount].string.Unwrap();
-                break;
-            }
-
-            case Type::FloatingPoint: {
-                snprintf(buf, 200, "%f", content[insertedArgumentCount].floatingPoint);
-                output += buf;
-            }
-            }
-
-            insertedArgumentCount++;
-            continue;
+// Writes the formatted text, in one pass.
+CELL_FUNCTION_INTERNAL void WriteFormat(char* output, const char* format, const size_t length, const size_t* positions, const Data* content,
+                                        const size_t count, const MeasuredArgument* measured) {
+    size_t literalStart = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t position = 0;
+        if (positions != nullptr) {
+            position = positions[i];
+        } else {
+            const char* placeholder = (const char*)memchr(format + literalStart, '%', length - literalStart);
+            CELL_ASSERT(placeholder != nullptr);
+
+            position = (size_t)(placeholder - format);
         }
 
-        char stuff[2] = { format[formatCharacterIndex], '\0' };
-        output += stuff;
+        Memory::Copy<char>(output, format + literalStart, position - literalStart);
+        output += position - literalStart;
+
+        WriteArgument(output, content[i], measured[i]);
+        output += measured[i].size;
+
+        literalStart = position + 1;
     }
 
-    CELL_ASSERT(insertedArgumentCount == count);
+    Memory::Copy<char>(output, format + literalStart, length - literalStart);
+}
+
+String String::FormatImplementation(const char* format, const size_t length, const size_t* positions, const Data* content, const size_t count) {
+    CELL_ASSERT(count <= MaxArguments);
+
+    MeasuredArgument measured[MaxArguments];
+    const size_t total = MeasureFormat(length, content, count, measured);
+
+    String output;
+    output.Reserve(total);
+
+    WriteFormat(output.GetData(), format, length, positions, content, count, measured);
+    output.size = total;
+
+    ReleaseMeasurements(content, count, measured);
+
     return output;
 }
 
+Wrapped<size_t, Result> String::FormatToImplementation(char* buffer, const size_t size, const char* format, const size_t length, const size_t* positions,
+                                                       const Data* content, const size_t count) {
+    CELL_ASSERT(count <= MaxArguments);
+
+    MeasuredArgument measured[MaxArguments];
+    const size_t total = MeasureFormat(length, content, count, measured);
+
+    if (total > size) {
+        ReleaseMeasurements(content, count, measured);
+        return Result::NotEnoughMemory;
+    }
+
+    WriteFormat(buffer, format, length, positions, content, count, measured);
+    ReleaseMeasurements(content, count, measured);
+
+    return total;
+}
+
 }
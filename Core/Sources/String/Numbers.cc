@@ -0,0 +1,482 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Memory/Allocator.hh>
+#include <Cell/StringDetails/Numbers.hh>
+
+#include "NumberTables.hh"
+
+namespace Cell::StringDetails {
+
+// Pairs of decimal digits, so that integers are written two digits at a time.
+static const char digitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Decimal form of a floating point number, as digits * 10^exponent.
+struct DecimalNumber {
+    uint64_t digits;
+    int32_t exponent;
+};
+
+constexpr uint32_t MantissaBits = 52;
+constexpr int32_t ExponentBias = 1023;
+constexpr int32_t Pow5Bits = 125;
+
+constexpr uint32_t FloatMantissaBits = 23;
+constexpr int32_t FloatExponentBias = 127;
+
+// Floats use the upper halves of the double tables, which are 125 - 64 bits long.
+constexpr int32_t FloatPow5Bits = Pow5Bits - 64;
+
+// ceil(log2(5^e)), or 1 for e = 0; valid up to e = 3528.
+CELL_FUNCTION_INTERNAL int32_t GetPow5Bits(const int32_t e) {
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e)), valid up to e = 1650.
+CELL_FUNCTION_INTERNAL uint32_t GetLog10Pow2(const int32_t e) {
+    return ((uint32_t)e * 78913) >> 18;
+}
+
+// floor(log10(5^e)), valid up to e = 2620.
+CELL_FUNCTION_INTERNAL uint32_t GetLog10Pow5(const int32_t e) {
+    return ((uint32_t)e * 732923) >> 20;
+}
+
+CELL_FUNCTION_INTERNAL uint32_t GetPow5Factor(uint64_t value) {
+    uint32_t count = 0;
+    while (value % 5 == 0) {
+        value /= 5;
+        count++;
+    }
+
+    return count;
+}
+
+CELL_FUNCTION_INTERNAL bool IsMultipleOfPow5(const uint64_t value, const uint32_t power) {
+    return GetPow5Factor(value) >= power;
+}
+
+CELL_FUNCTION_INTERNAL bool IsMultipleOfPow2(const uint64_t value, const uint32_t power) {
+    return (value & ((1ull << power) - 1)) == 0;
+}
+
+// (m * multiplier) >> shift, with a 128 bit multiplier and shift of at least 64.
+CELL_FUNCTION_INTERNAL uint64_t MultiplyShift(const uint64_t m, const uint64_t* multiplier, const int32_t shift) {
+    const unsigned __int128 low = (unsigned __int128)m * multiplier[0];
+    const unsigned __int128 high = (unsigned __int128)m * multiplier[1];
+
+    return (uint64_t)(((low >> 64) + high) >> (shift - 64));
+}
+
+// (m * multiplier) >> shift, with a 64 bit multiplier and shift of more than 32.
+CELL_FUNCTION_INTERNAL uint32_t MultiplyShift32(const uint32_t m, const uint64_t multiplier, const int32_t shift) {
+    const uint64_t low = (uint64_t)m * (uint32_t)multiplier;
+    const uint64_t high = (uint64_t)m * (uint32_t)(multiplier >> 32);
+
+    return (uint32_t)(((low >> 32) + high) >> (shift - 32));
+}
+
+// m * 2^shift / 5^q, using the upper half of the inverse table; it's stored rounded up in full, but not in its upper half.
+CELL_FUNCTION_INTERNAL uint32_t MultiplyPow5Inverse32(const uint32_t m, const uint32_t q, const int32_t shift) {
+    return MultiplyShift32(m, Pow5InverseSplit[q][1] + 1, shift);
+}
+
+// m * 5^i / 2^shift, using the upper half of the table.
+CELL_FUNCTION_INTERNAL uint32_t MultiplyPow5_32(const uint32_t m, const uint32_t i, const int32_t shift) {
+    return MultiplyShift32(m, Pow5Split[i][1], shift);
+}
+
+// Converts a finite, non-zero double to the shortest decimal within its rounding interval, closest to the exact value (Ryu).
+CELL_FUNCTION_INTERNAL DecimalNumber ToDecimal(const uint64_t mantissa, const uint32_t exponent) {
+    int32_t e2 = 0;
+    uint64_t m2 = 0;
+
+    if (exponent == 0) {
+        e2 = 1 - ExponentBias - (int32_t)MantissaBits - 2;
+        m2 = mantissa;
+    } else {
+        e2 = (int32_t)exponent - ExponentBias - (int32_t)MantissaBits - 2;
+        m2 = (1ull << MantissaBits) | mantissa;
+    }
+
+    // the interval of values rounding to this double is [mm, mp] / 4 * 2^e2, halfway to the neighbours on either side
+    const bool acceptBounds = (m2 & 1) == 0;
+    const uint64_t mv = 4 * m2;
+    const uint32_t mmShift = mantissa != 0 || exponent <= 1 ? 1 : 0;
+
+    uint64_t vr = 0;
+    uint64_t vp = 0;
+    uint64_t vm = 0;
+    int32_t e10 = 0;
+
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+
+    if (e2 >= 0) {
+        const uint32_t q = GetLog10Pow2(e2) - (e2 > 3 ? 1 : 0);
+        const int32_t shift = -e2 + (int32_t)q + Pow5Bits + GetPow5Bits((int32_t)q) - 1;
+
+        e10 = (int32_t)q;
+        vr = MultiplyShift(mv, Pow5InverseSplit[q], shift);
+        vp = MultiplyShift(mv + 2, Pow5InverseSplit[q], shift);
+        vm = MultiplyShift(mv - 1 - mmShift, Pow5InverseSplit[q], shift);
+
+        // only small powers of ten can divide the bounds exactly
+        if (q <= 21) {
+            if (mv % 5 == 0) {
+                vrIsTrailingZeros = IsMultipleOfPow5(mv, q);
+            } else if (acceptBounds) {
+                vmIsTrailingZeros = IsMultipleOfPow5(mv - 1 - mmShift, q);
+            } else {
+                vp -= IsMultipleOfPow5(mv + 2, q) ? 1 : 0;
+            }
+        }
+    } else {
+        const uint32_t q = GetLog10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+        const int32_t index = -e2 - (int32_t)q;
+        const int32_t shift = (int32_t)q - (GetPow5Bits(index) - Pow5Bits);
+
+        e10 = (int32_t)q + e2;
+        vr = MultiplyShift(mv, Pow5Split[index], shift);
+        vp = MultiplyShift(mv + 2, Pow5Split[index], shift);
+        vm = MultiplyShift(mv - 1 - mmShift, Pow5Split[index], shift);
+
+        if (q <= 1) {
+            // mv has at least two trailing zero bits, so vr does too
+            vrIsTrailingZeros = true;
+            if (acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            } else {
+                vp--;
+            }
+        } else if (q < 63) {
+            vrIsTrailingZeros = IsMultipleOfPow2(mv, q);
+        }
+    }
+
+    // drop digits for as long as the result stays within the interval
+    int32_t removed = 0;
+    uint8_t lastRemovedDigit = 0;
+    uint64_t output = 0;
+
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        // rare: the bounds or the exact value end in zeros, which decides ties
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+
+        // exactly halfway rounds to even
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+            lastRemovedDigit = 4;
+        }
+
+        output = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5) ? 1 : 0);
+    } else {
+        bool roundUp = false;
+        if (vp / 100 > vm / 100) {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+
+        while (vp / 10 > vm / 10) {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        output = vr + ((vr == vm || roundUp) ? 1 : 0);
+    }
+
+    return { .digits = output, .exponent = e10 + removed };
+}
+
+// Converts a finite, non-zero float to the shortest decimal within its rounding interval, closest to the exact value.
+// Works like the double version, in 32 bits, except that one removed digit is computed up front where the loop below might not get to it.
+CELL_FUNCTION_INTERNAL DecimalNumber ToDecimal32(const uint32_t mantissa, const uint32_t exponent) {
+    int32_t e2 = 0;
+    uint32_t m2 = 0;
+
+    if (exponent == 0) {
+        e2 = 1 - FloatExponentBias - (int32_t)FloatMantissaBits - 2;
+        m2 = mantissa;
+    } else {
+        e2 = (int32_t)exponent - FloatExponentBias - (int32_t)FloatMantissaBits - 2;
+        m2 = (1u << FloatMantissaBits) | mantissa;
+    }
+
+    const bool acceptBounds = (m2 & 1) == 0;
+    const uint32_t mv = 4 * m2;
+    const uint32_t mmShift = mantissa != 0 || exponent <= 1 ? 1 : 0;
+
+    uint32_t vr = 0;
+    uint32_t vp = 0;
+    uint32_t vm = 0;
+    int32_t e10 = 0;
+
+    bool vmIsTrailingZeros = false;
+    bool vrIsTrailingZeros = false;
+    uint8_t lastRemovedDigit = 0;
+
+    if (e2 >= 0) {
+        const uint32_t q = GetLog10Pow2(e2);
+        const int32_t shift = -e2 + (int32_t)q + FloatPow5Bits + GetPow5Bits((int32_t)q) - 1;
+
+        e10 = (int32_t)q;
+        vr = MultiplyPow5Inverse32(mv, q, shift);
+        vp = MultiplyPow5Inverse32(mv + 2, q, shift);
+        vm = MultiplyPow5Inverse32(mv - 1 - mmShift, q, shift);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            const int32_t previousShift = -e2 + (int32_t)q - 1 + FloatPow5Bits + GetPow5Bits((int32_t)q - 1) - 1;
+            lastRemovedDigit = (uint8_t)(MultiplyPow5Inverse32(mv, q - 1, previousShift) % 10);
+        }
+
+        if (q <= 9) {
+            if (mv % 5 == 0) {
+                vrIsTrailingZeros = IsMultipleOfPow5(mv, q);
+            } else if (acceptBounds) {
+                vmIsTrailingZeros = IsMultipleOfPow5(mv - 1 - mmShift, q);
+            } else {
+                vp -= IsMultipleOfPow5(mv + 2, q) ? 1 : 0;
+            }
+        }
+    } else {
+        const uint32_t q = GetLog10Pow5(-e2);
+        const int32_t index = -e2 - (int32_t)q;
+        const int32_t shift = (int32_t)q - (GetPow5Bits(index) - FloatPow5Bits);
+
+        e10 = (int32_t)q + e2;
+        vr = MultiplyPow5_32(mv, (uint32_t)index, shift);
+        vp = MultiplyPow5_32(mv + 2, (uint32_t)index, shift);
+        vm = MultiplyPow5_32(mv - 1 - mmShift, (uint32_t)index, shift);
+
+        if (q != 0 && (vp - 1) / 10 <= vm / 10) {
+            const int32_t previousShift = (int32_t)q - 1 - (GetPow5Bits(index + 1) - FloatPow5Bits);
+            lastRemovedDigit = (uint8_t)(MultiplyPow5_32(mv, (uint32_t)index + 1, previousShift) % 10);
+        }
+
+        if (q <= 1) {
+            vrIsTrailingZeros = true;
+            if (acceptBounds) {
+                vmIsTrailingZeros = mmShift == 1;
+            } else {
+                vp--;
+            }
+        } else if (q < 31) {
+            vrIsTrailingZeros = IsMultipleOfPow2(mv, q - 1);
+        }
+    }
+
+    int32_t removed = 0;
+    uint32_t output = 0;
+
+    if (vmIsTrailingZeros || vrIsTrailingZeros) {
+        while (vp / 10 > vm / 10) {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        if (vmIsTrailingZeros) {
+            while (vm % 10 == 0) {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) {
+            lastRemovedDigit = 4;
+        }
+
+        output = vr + (((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5) ? 1 : 0);
+    } else {
+        while (vp / 10 > vm / 10) {
+            lastRemovedDigit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+
+        output = vr + ((vr == vm || lastRemovedDigit >= 5) ? 1 : 0);
+    }
+
+    return { .digits = output, .exponent = e10 + removed };
+}
+
+// Writes the digits of the given value, which has exactly count of them, from the back.
+CELL_FUNCTION_INTERNAL void WriteDigits(char* output, uint64_t value, size_t count) {
+    while (count >= 2) {
+        const size_t pair = (size_t)(value % 100) * 2;
+        value /= 100;
+
+        output[--count] = digitPairs[pair + 1];
+        output[--count] = digitPairs[pair];
+    }
+
+    if (count == 1) {
+        output[0] = (char)('0' + value);
+    }
+}
+
+size_t FormatUnsigned(char* output, const uint64_t value) {
+    const size_t count = CountDigits(value);
+    WriteDigits(output, value, count);
+
+    return count;
+}
+
+size_t FormatSigned(char* output, const int64_t value) {
+    if (value >= 0) {
+        return FormatUnsigned(output, (uint64_t)value);
+    }
+
+    output[0] = '-';
+    return FormatUnsigned(output + 1, 0 - (uint64_t)value) + 1;
+}
+
+// Writes the given decimal, plainly or in scientific notation depending on its magnitude, and returns the number of bytes written.
+CELL_FUNCTION_INTERNAL size_t WriteDecimal(char* output, const DecimalNumber decimal) {
+    size_t size = 0;
+
+    char digits[20];
+    const int32_t count = (int32_t)FormatUnsigned(digits, decimal.digits);
+    const int32_t scientificExponent = decimal.exponent + count - 1;
+
+    if (scientificExponent < -7 || scientificExponent >= 21) {
+        // d.ddde+x, with the point left out for a single digit
+        output[size++] = digits[0];
+
+        if (count > 1) {
+            output[size++] = '.';
+            Memory::Copy<char>(output + size, digits + 1, (size_t)count - 1);
+            size += (size_t)count - 1;
+        }
+
+        output[size++] = 'e';
+        output[size++] = scientificExponent < 0 ? '-' : '+';
+        return size + FormatUnsigned(output + size, (uint64_t)(scientificExponent < 0 ? -scientificExponent : scientificExponent));
+    }
+
+    if (decimal.exponent >= 0) {
+        // ddd000
+        Memory::Copy<char>(output + size, digits, (size_t)count);
+        size += (size_t)count;
+
+        for (int32_t i = 0; i < decimal.exponent; i++) {
+            output[size++] = '0';
+        }
+
+        return size;
+    }
+
+    if (scientificExponent >= 0) {
+        // ddd.ddd
+        const size_t integerCount = (size_t)scientificExponent + 1;
+
+        Memory::Copy<char>(output + size, digits, integerCount);
+        output[size + integerCount] = '.';
+        Memory::Copy<char>(output + size + integerCount + 1, digits + integerCount, (size_t)count - integerCount);
+
+        return size + (size_t)count + 1;
+    }
+
+    // 0.000ddd
+    output[size++] = '0';
+    output[size++] = '.';
+
+    for (int32_t i = 0; i < -scientificExponent - 1; i++) {
+        output[size++] = '0';
+    }
+
+    Memory::Copy<char>(output + size, digits, (size_t)count);
+    return size + (size_t)count;
+}
+
+size_t FormatDouble(char* output, const double value) {
+    const uint64_t bits = __builtin_bit_cast(uint64_t, value);
+    const uint64_t mantissa = bits & ((1ull << MantissaBits) - 1);
+    const uint32_t exponent = (uint32_t)(bits >> MantissaBits) & 0x7ff;
+
+    size_t size = 0;
+    if (bits >> 63 != 0 && !(exponent == 0x7ff && mantissa != 0)) {
+        output[size++] = '-';
+    }
+
+    if (exponent == 0x7ff) {
+        Memory::Copy<char>(output + size, mantissa != 0 ? "nan" : "inf", 3);
+        return size + 3;
+    }
+
+    if (exponent == 0 && mantissa == 0) {
+        output[size] = '0';
+        return size + 1;
+    }
+
+    return size + WriteDecimal(output + size, ToDecimal(mantissa, exponent));
+}
+
+size_t FormatFloat(char* output, const float value) {
+    const uint32_t bits = __builtin_bit_cast(uint32_t, value);
+    const uint32_t mantissa = bits & ((1u << FloatMantissaBits) - 1);
+    const uint32_t exponent = (bits >> FloatMantissaBits) & 0xff;
+
+    size_t size = 0;
+    if (bits >> 31 != 0 && !(exponent == 0xff && mantissa != 0)) {
+        output[size++] = '-';
+    }
+
+    if (exponent == 0xff) {
+        Memory::Copy<char>(output + size, mantissa != 0 ? "nan" : "inf", 3);
+        return size + 3;
+    }
+
+    if (exponent == 0 && mantissa == 0) {
+        output[size] = '0';
+        return size + 1;
+    }
+
+    return size + WriteDecimal(output + size, ToDecimal32(mantissa, exponent));
+}
+
+}
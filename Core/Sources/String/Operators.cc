@@ -12,64 +12,67 @@ String& String::operator = (const String& input) {
         return *this;
     }
 
-    if (this->data != nullptr) {
-        Memory::Free(this->data);
-        this->data = nullptr;
-    }
-
-    this->size = input.size;
-    if (input.size > 0) {
-        this->data = Memory::Allocate<char>(input.size);
-        Memory::Copy<char>(this->data, input.data, input.size);
-    }
-
+    this->AssignData(input.GetData(), input.size);
     return *this;
 }
 
-String& String::operator = (const char* input) {
-    if (this->data != nullptr) {
-        Memory::Free(this->data);
-        this->data = nullptr;
+String& String::operator = (String&& input) {
+    if (this == &input) {
+        return *this;
     }
 
-    this->size = StringDetails::RawStringSize(input);
-    if (this->size > 0) {
-        this->data = Memory::Allocate<char>(this->size);
-        Memory::Copy<char>(this->data, input, this->size);
+    // only storage from the same place can be taken over
+    if (input.IsInline() || input.arena != this->arena) {
+        this->AssignData(input.GetData(), input.size);
+        input.size = 0;
+        return *this;
     }
 
+    this->FreeData();
+
+    this->data = input.data;
+    this->size = input.size;
+    this->capacity = input.capacity;
+
+    input.size = 0;
+    input.capacity = StringDetails::InlineCapacity;
     return *this;
 }
 
-bool String::operator == (const String& other) const {
-    if (this == &other) {
-        return true;
-    }
-
-    if (this->size != other.size) {
-        return false;
-    }
+String& String::operator = (const char* input) {
+    this->AssignData(input, StringDetails::RawStringSize(input));
+    return *this;
+}
 
-    return Memory::Compare(this->data, other.data, this->size);
+bool String::operator == (const StringView other) const {
+    return StringView(*this) == other;
 }
 
-bool String::operator != (const String& other) const {
+bool String::operator != (const StringView other) const {
     return !(*this == other);
 }
 
-String String::operator + (const String& input) const {
-    String out(this->data, this->size);
-    out.Append(input);
+String String::operator + (const StringView input) const {
+    String out;
+    out.Reserve(this->size + input.GetSize());
+
+    out.AppendData(this->GetData(), this->size);
+    out.AppendData(input.ToRawPointer(), input.GetSize());
     return out;
 }
 
 String String::operator + (const char* input) const {
-    String out(this->data, this->size);
-    out.Append(input);
+    const size_t inputSize = StringDetails::RawStringSize(input);
+
+    String out;
+    out.Reserve(this->size + inputSize);
+
+    out.AppendData(this->GetData(), this->size);
+    out.AppendData(input, inputSize);
     return out;
 }
 
-void String::operator += (const String& input) {
+void String::operator += (const StringView input) {
     this->Append(input);
 }
 
@@ -78,11 +81,11 @@ void String::operator += (const char* input) {
 }
 
 char* String::begin() {
-    return this->data;
+    return this->GetData();
 }
 
 char* String::end() {
-    return this->data + this->size;
+    return this->GetData() + this->size;
 }
 
 }
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/StringView.hh>
+#include <Cell/Memory/Allocator.hh>
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace Cell {
+using namespace StringDetails;
+
+// Size of the stack buffer AsDouble copies text into, as strtod needs it null terminated; longer text is copied to the heap.
+constexpr size_t InlineDoubleSize = 64;
+
+size_t StringView::Find(const StringView text, const size_t offset) const {
+    if (offset > this->size || text.size > this->size - offset) {
+        return NotFound;
+    }
+
+    if (text.size == 0) {
+        return offset;
+    }
+
+    // look for the first byte, and only compare the rest where it matches
+    const char* cursor = this->data + offset;
+    const char* last = this->data + (this->size - text.size);
+    while (cursor <= last) {
+        cursor = (const char*)memchr(cursor, text.data[0], (size_t)(last - cursor) + 1);
+        if (cursor == nullptr) {
+            return NotFound;
+        }
+
+        if (Memory::Compare(cursor + 1, text.data + 1, text.size - 1)) {
+            return (size_t)(cursor - this->data);
+        }
+
+        cursor++;
+    }
+
+    return NotFound;
+}
+
+Wrapped<uint64_t, Result> StringView::AsNumber(const bool isHex) const {
+    if (this->size == 0) {
+        return Result::InvalidFormat;
+    }
+
+    const uint64_t base = isHex ? 16 : 10;
+
+    uint64_t number = 0;
+    for (const char character : *this) {
+        uint64_t digit = 0;
+        if (character >= '0' && character <= '9') {
+            digit = (uint64_t)(character - '0');
+        } else if (isHex && character >= 'a' && character <= 'f') {
+            digit = (uint64_t)(character - 'a' + 10);
+        } else if (isHex && character >= 'A' && character <= 'F') {
+            digit = (uint64_t)(character - 'A' + 10);
+        } else {
+            return Result::InvalidFormat;
+        }
+
+        if (number > (UINT64_MAX - digit) / base) {
+            return Result::InvalidFormat;
+        }
+
+        number = number * base + digit;
+    }
+
+    return number;
+}
+
+Wrapped<int64_t, Result> StringView::AsSignedNumber() const {
+    const bool isNegative = this->size > 0 && this->data[0] == '-';
+    const bool hasSign = isNegative || (this->size > 0 && this->data[0] == '+');
+
+    Wrapped<uint64_t, Result> magnitude = this->SkipTo(hasSign ? 1 : 0).AsNumber();
+    if (!magnitude.IsValid() || (hasSign && this->size == 1)) {
+        return Result::InvalidFormat;
+    }
+
+    const uint64_t value = magnitude.Unwrap();
+    if (value > (uint64_t)INT64_MAX + (isNegative ? 1 : 0)) {
+        return Result::InvalidFormat;
+    }
+
+    return isNegative ? (int64_t)(0 - value) : (int64_t)value;
+}
+
+Wrapped<double, Result> StringView::AsDouble() const {
+    if (this->size == 0) {
+        return Result::InvalidFormat;
+    }
+
+    // strtod skips leading white space, which isn't part of a number
+    const char first = this->data[0];
+    if (!((first >= '0' && first <= '9') || first == '-' || first == '+' || first == '.')) {
+        return Result::InvalidFormat;
+    }
+
+    char inlineBuffer[InlineDoubleSize];
+    char* terminated = this->size < InlineDoubleSize ? inlineBuffer : Memory::AllocateUninitialized<char>(this->size + 1);
+
+    Memory::Copy<char>(terminated, this->data, this->size);
+    terminated[this->size] = '\0';
+
+    char* end = nullptr;
+    const double value = strtod(terminated, &end);
+    const bool complete = end == terminated + this->size;
+
+    if (terminated != inlineBuffer) {
+        Memory::Free(terminated);
+    }
+
+    if (!complete) {
+        return Result::InvalidFormat;
+    }
+
+    return value;
+}
+
+}
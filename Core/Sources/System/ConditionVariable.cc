@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/ConditionVariable.hh>
+#include <Cell/System/Futex.hh>
+
+namespace Cell::System {
+
+Result ConditionVariable::Wait(Mutex& mutex, const uint32_t timeoutMs) {
+    __atomic_add_fetch(&this->waiters, 1, __ATOMIC_SEQ_CST);
+
+    // read with the mutex held; a notification for a change made under the mutex can only come after this
+    const uint32_t sequence = __atomic_load_n(&this->sequence, __ATOMIC_SEQ_CST);
+
+    mutex.Unlock();
+    const Result result = FutexWait(&this->sequence, sequence, timeoutMs);
+    mutex.Lock();
+
+    __atomic_sub_fetch(&this->waiters, 1, __ATOMIC_RELAXED);
+    return result;
+}
+
+void ConditionVariable::Signal() {
+    __atomic_add_fetch(&this->sequence, 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&this->waiters, __ATOMIC_SEQ_CST) > 0) {
+        FutexWake(&this->sequence);
+    }
+}
+
+void ConditionVariable::Broadcast() {
+    __atomic_add_fetch(&this->sequence, 1, __ATOMIC_SEQ_CST);
+
+    if (__atomic_load_n(&this->waiters, __ATOMIC_SEQ_CST) > 0) {
+        FutexWakeAll(&this->sequence);
+    }
+}
+
+}
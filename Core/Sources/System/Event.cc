@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Event.hh>
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Timer.hh>
+
+namespace Cell::System {
+
+// Number of times the state is checked again before sleeping, for signals that are just about to happen, e.g. per-frame handoffs.
+constexpr uint32_t EventSpinCount = 100;
+
+Result Event::WaitContended(const uint32_t timeoutMs) {
+    for (uint32_t i = 0; i < EventSpinCount; i++) {
+        if (__atomic_load_n(&this->state, __ATOMIC_ACQUIRE) == Signaled) {
+            return Result::Success;
+        }
+
+        CpuRelax();
+    }
+
+    const uint64_t deadline = timeoutMs > 0 ? GetPreciseTickerValue() + (uint64_t)timeoutMs * 1000 : 0;
+
+    while (true) {
+        uint32_t state = __atomic_load_n(&this->state, __ATOMIC_ACQUIRE);
+        if (state == Signaled) {
+            return Result::Success;
+        }
+
+        // mark the event, so the signaling thread knows to wake anyone up
+        if (state == Unsignaled && !__atomic_compare_exchange_n(&this->state, &state, UnsignaledWithWaiters, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            continue;
+        }
+
+        uint32_t remainingMs = 0;
+        if (deadline != 0) {
+            const uint64_t now = GetPreciseTickerValue();
+            if (now >= deadline) {
+                return Result::Timeout;
+            }
+
+            // rounded up, as a timeout of zero would block forever
+            remainingMs = (uint32_t)((deadline - now + 999) / 1000);
+        }
+
+        FutexWait(&this->state, UnsignaledWithWaiters, remainingMs);
+    }
+}
+
+void Event::WakeWaiters() {
+    FutexWakeAll(&this->state);
+}
+
+}
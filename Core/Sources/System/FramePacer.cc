@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/FramePacer.hh>
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Panic.hh>
+#include <Cell/System/Ticks.hh>
+#include <Cell/System/Timer.hh>
+
+namespace Cell::System {
+
+// Spin margin to start out with, in microseconds; generous, as it only costs processor time until calibrated.
+constexpr uint64_t InitialSpinMargin = 1000;
+
+// Spin margin kept at minimum, in microseconds, to absorb small variations without ever waking up late.
+constexpr uint64_t MinimumSpinMargin = 20;
+
+// Share of the difference the spin margin shrinks by per wait, once sleeps wake up earlier than it expects.
+constexpr uint64_t SpinMarginDecay = 16;
+
+// Largest share of the interval that's spun; short intervals would otherwise spin entire frames away.
+constexpr uint64_t MaximumSpinShare = 4;
+
+CELL_FUNCTION_INTERNAL uint64_t ClampSpinMargin(const uint64_t spinMargin, const uint64_t interval) {
+    const uint64_t maximum = interval / MaximumSpinShare;
+    return spinMargin > maximum ? maximum : spinMargin;
+}
+
+FramePacer::FramePacer(const uint64_t interval) : interval(interval), spinMargin(ClampSpinMargin(InitialSpinMargin, interval)) {
+    CELL_ASSERT(interval > 0);
+
+    this->next = GetPreciseTickerValue() + interval;
+}
+
+uint64_t FramePacer::Wait() {
+    const uint64_t deadline = this->next;
+    const uint64_t woken = this->WaitUntil(deadline);
+
+    this->next = deadline + this->interval;
+    if (woken >= this->next) {
+        this->missedFrames++;
+        this->next = woken + this->interval;
+    }
+
+    return woken;
+}
+
+uint64_t FramePacer::WaitUntil(const uint64_t deadline) {
+    uint64_t now = GetPreciseTickerValue();
+
+    if (deadline > now + this->spinMargin) {
+        const uint64_t target = deadline - this->spinMargin;
+        SleepUntil(target);
+
+        // calibrate against how late the sleep woke up; raised right away, so the next wait doesn't wake up late as well,
+        //  but only lowered gradually, as single early wake-ups say little
+        now = GetPreciseTickerValue();
+        const uint64_t late = (now > target ? now - target : 0) + MinimumSpinMargin;
+
+        if (late > this->spinMargin) {
+            this->spinMargin = late;
+        } else {
+            this->spinMargin -= (this->spinMargin - late) / SpinMarginDecay;
+        }
+
+        // a sleep that's off by a good part of an interval is a hiccup, not the norm
+        this->spinMargin = ClampSpinMargin(this->spinMargin, this->interval);
+    }
+
+    // the tail is spun on ticks, which are much cheaper to read than the clock
+    if (now < deadline) {
+        const uint64_t spinEnd = GetTicks() + GetTickCalibration().FromMicroseconds(deadline - now);
+        while (GetTicks() < spinEnd) {
+            CpuRelax();
+        }
+
+        now = GetPreciseTickerValue();
+        while (now < deadline) {
+            now = GetPreciseTickerValue();
+        }
+    }
+
+    const uint64_t late = now - deadline;
+
+    uint32_t bucket = 0;
+    while (bucket < FramePacerJitterBuckets - 1 && late >= (1ull << bucket)) {
+        bucket++;
+    }
+
+    this->jitter[bucket]++;
+    return now;
+}
+
+void FramePacer::Reset() {
+    this->next = GetPreciseTickerValue() + this->interval;
+}
+
+void FramePacer::SetInterval(const uint64_t interval) {
+    CELL_ASSERT(interval > 0);
+
+    // rescheduled from the previous frame, so changing the interval doesn't push the upcoming one back
+    this->next = this->next - this->interval + interval;
+    this->interval = interval;
+    this->spinMargin = ClampSpinMargin(this->spinMargin, interval);
+}
+
+void FramePacer::ResetStatistics() {
+    this->missedFrames = 0;
+
+    for (uint32_t i = 0; i < FramePacerJitterBuckets; i++) {
+        this->jitter[i] = 0;
+    }
+}
+
+}
@@ -0,0 +1,357 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Collection/WorkStealingDeque.hh>
+#include <Cell/System/Event.hh>
+#include <Cell/System/JobSystem.hh>
+#include <Cell/System/Thread.hh>
+
+namespace Cell::System {
+
+namespace JobSystemDetails {
+
+// Number of jobs the shared queue for threads other than the workers holds.
+constexpr size_t InjectedCapacity = 4096;
+
+// Number of times an idle worker looks for jobs again before going to sleep.
+constexpr uint32_t IdleRounds = 64;
+
+struct Job : public Object {
+    JobFunction function;
+    void* parameter;
+    JobCounter* counter;
+
+    // next job waiting on the same dependency
+    Job* next;
+};
+
+struct alignas(Memory::CacheLineSize) Worker {
+    Collection::WorkStealingDeque<Job*> deque;
+    Event wake;
+
+    JobSystem* system;
+    Thread* thread;
+
+    bool sleeping;
+    uint32_t seed;
+};
+
+struct ParallelForBatch {
+    JobRangeFunction function;
+    void* parameter;
+    size_t begin;
+    size_t end;
+};
+
+// the worker the calling thread is, if any
+static thread_local Worker* currentWorker = nullptr;
+
+}
+
+using namespace JobSystemDetails;
+
+JobSystem::JobSystem(const uint32_t workerCount) : injected(InjectedCapacity) {
+    uint32_t count = workerCount;
+    if (count == 0) {
+        const uint32_t processors = Thread::GetProcessorCount();
+        count = processors > 1 ? processors - 1 : 1;
+    }
+
+    this->workers = Memory::AllocateAligned<Worker>(count, Memory::CacheLineSize);
+    this->workerCount = count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        Worker* worker = Memory::Construct<Worker>(this->workers + i);
+        worker->system = this;
+        worker->thread = nullptr;
+        worker->sleeping = false;
+        worker->seed = i * 2654435761u + 1;
+    }
+
+    // every worker has to exist before the first one starts stealing
+    for (uint32_t i = 0; i < count; i++) {
+        this->workers[i].thread = new Thread([](void* parameter) {
+            Worker* worker = (Worker*)parameter;
+            worker->system->RunWorker(worker);
+        }, this->workers + i, "Cell Job Worker");
+    }
+}
+
+JobSystem::~JobSystem() {
+    __atomic_store_n(&this->running, false, __ATOMIC_SEQ_CST);
+
+    for (uint32_t i = 0; i < this->workerCount; i++) {
+        this->workers[i].wake.Signal();
+    }
+
+    for (uint32_t i = 0; i < this->workerCount; i++) {
+        this->workers[i].thread->Join();
+        delete this->workers[i].thread;
+    }
+
+    // with the workers gone, their deques can be drained from here
+    Job* job = this->FindJob(nullptr);
+    while (job != nullptr) {
+        this->Execute(job);
+        job = this->FindJob(nullptr);
+    }
+
+    for (uint32_t i = 0; i < this->workerCount; i++) {
+        Memory::Destruct<Worker>(this->workers + i);
+    }
+
+    Memory::FreeAligned(this->workers);
+}
+
+void JobSystem::Run(JobFunction function, void* parameter, JobCounter* counter) {
+    if (counter != nullptr) {
+        __atomic_add_fetch(&counter->value, 1, __ATOMIC_RELAXED);
+    }
+
+    Job* job = new Job;
+    job->function = function;
+    job->parameter = parameter;
+    job->counter = counter;
+    job->next = nullptr;
+
+    this->Submit(job);
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, JobFunction function, void* parameter, JobCounter* counter) {
+    if (counter != nullptr) {
+        __atomic_add_fetch(&counter->value, 1, __ATOMIC_RELAXED);
+    }
+
+    Job* job = new Job;
+    job->function = function;
+    job->parameter = parameter;
+    job->counter = counter;
+    job->next = nullptr;
+
+    while (__atomic_exchange_n(&dependency.lock, 1, __ATOMIC_ACQUIRE) != 0) {
+        Thread::Yield();
+    }
+
+    // the lock orders this against the job bringing the dependency to zero; either it sees this job, or this sees zero
+    const bool done = __atomic_load_n(&dependency.value, __ATOMIC_ACQUIRE) == 0;
+    if (!done) {
+        job->next = dependency.waiting;
+        dependency.waiting = job;
+    }
+
+    __atomic_store_n(&dependency.lock, 0, __ATOMIC_RELEASE);
+
+    if (done) {
+        this->Submit(job);
+    }
+}
+
+void JobSystem::Track(JobCounter& counter) {
+    __atomic_add_fetch(&counter.value, 1, __ATOMIC_RELAXED);
+}
+
+void JobSystem::Finish(JobCounter& counter) {
+    this->Complete(counter);
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    Worker* self = this->GetCurrentWorker();
+
+    while (!counter.IsDone()) {
+        Job* job = this->FindJob(self);
+        if (job != nullptr) {
+            this->Execute(job);
+        } else {
+            Thread::Yield();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(const size_t count, const size_t batchSize, JobRangeFunction function, void* parameter) {
+    CELL_ASSERT(batchSize > 0);
+
+    if (count == 0) {
+        return;
+    }
+
+    const size_t batchCount = (count + batchSize - 1) / batchSize;
+    if (batchCount == 1) {
+        function(0, count, parameter);
+        return;
+    }
+
+    ParallelForBatch* batches = Memory::Allocate<ParallelForBatch>(batchCount);
+    JobCounter counter;
+
+    for (size_t i = 0; i < batchCount; i++) {
+        batches[i].function = function;
+        batches[i].parameter = parameter;
+        batches[i].begin = i * batchSize;
+        batches[i].end = i == batchCount - 1 ? count : (i + 1) * batchSize;
+    }
+
+    // the first batch is left for the calling thread, which would otherwise only start helping once everything is queued
+    for (size_t i = 1; i < batchCount; i++) {
+        this->Run([](void* data) {
+            const ParallelForBatch* batch = (const ParallelForBatch*)data;
+            batch->function(batch->begin, batch->end, batch->parameter);
+        }, batches + i, &counter);
+    }
+
+    function(batches[0].begin, batches[0].end, parameter);
+
+    this->Wait(counter);
+    Memory::Free(batches);
+}
+
+void JobSystem::Submit(Job* job) {
+    // counted before it's visible, so a worker about to sleep can't miss it
+    __atomic_add_fetch(&this->pending, 1, __ATOMIC_SEQ_CST);
+
+    Worker* self = this->GetCurrentWorker();
+    if (self != nullptr) {
+        self->deque.Push(job);
+    } else {
+        while (!this->injected.Push(job)) {
+            // the shared queue is full; make room by helping out
+            Job* other = this->FindJob(nullptr);
+            if (other != nullptr) {
+                this->Execute(other);
+            } else {
+                Thread::Yield();
+            }
+        }
+    }
+
+    this->WakeOne();
+}
+
+void JobSystem::Execute(Job* job) {
+    job->function(job->parameter);
+
+    JobCounter* counter = job->counter;
+    delete job;
+
+    if (counter != nullptr) {
+        this->Complete(*counter);
+    }
+}
+
+void JobSystem::Complete(JobCounter& counter) {
+    uint32_t value = __atomic_load_n(&counter.value, __ATOMIC_RELAXED);
+    while (value > 1) {
+        if (__atomic_compare_exchange_n(&counter.value, &value, value - 1, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+
+    // possibly the last job; the lock keeps RunAfter from adding to the list while it's being taken,
+    //  and waiters from considering the counter done before it's no longer touched here
+    while (__atomic_exchange_n(&counter.lock, 1, __ATOMIC_ACQUIRE) != 0) {
+        Thread::Yield();
+    }
+
+    Job* waiting = nullptr;
+    if (__atomic_sub_fetch(&counter.value, 1, __ATOMIC_ACQ_REL) == 0) {
+        waiting = counter.waiting;
+        counter.waiting = nullptr;
+    }
+
+    __atomic_store_n(&counter.lock, 0, __ATOMIC_RELEASE);
+
+    while (waiting != nullptr) {
+        Job* next = waiting->next;
+        this->Submit(waiting);
+
+        waiting = next;
+    }
+}
+
+void JobSystem::WakeOne() {
+    for (uint32_t i = 0; i < this->workerCount; i++) {
+        Worker& worker = this->workers[i];
+
+        bool sleeping = __atomic_load_n(&worker.sleeping, __ATOMIC_SEQ_CST);
+        if (sleeping && __atomic_compare_exchange_n(&worker.sleeping, &sleeping, false, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            worker.wake.Signal();
+            return;
+        }
+    }
+}
+
+Job* JobSystem::FindJob(Worker* self) {
+    Job* job = nullptr;
+
+    bool found = self != nullptr && self->deque.Pop(job);
+    if (!found) {
+        found = this->injected.Pop(job);
+    }
+
+    if (!found) {
+        // start stealing at a random victim, so thieves don't all pile up on the same worker
+        uint32_t start = 0;
+        if (self != nullptr) {
+            self->seed ^= self->seed << 13;
+            self->seed ^= self->seed >> 17;
+            self->seed ^= self->seed << 5;
+            start = self->seed;
+        } else {
+            start = __atomic_fetch_add(&this->nextVictim, 1, __ATOMIC_RELAXED);
+        }
+
+        for (uint32_t i = 0; i < this->workerCount && !found; i++) {
+            Worker* victim = this->workers + (start + i) % this->workerCount;
+            if (victim != self) {
+                found = victim->deque.Steal(job);
+            }
+        }
+    }
+
+    if (!found) {
+        return nullptr;
+    }
+
+    __atomic_sub_fetch(&this->pending, 1, __ATOMIC_RELAXED);
+    return job;
+}
+
+Worker* JobSystem::GetCurrentWorker() const {
+    Worker* worker = currentWorker;
+    return worker != nullptr && worker->system == this ? worker : nullptr;
+}
+
+void JobSystem::RunWorker(Worker* worker) {
+    currentWorker = worker;
+
+    uint32_t idleRounds = 0;
+    while (__atomic_load_n(&this->running, __ATOMIC_SEQ_CST)) {
+        Job* job = this->FindJob(worker);
+        if (job != nullptr) {
+            this->Execute(job);
+            idleRounds = 0;
+            continue;
+        }
+
+        if (idleRounds++ < IdleRounds) {
+            Thread::Yield();
+            continue;
+        }
+
+        // announce sleeping first, then check again; a job queued in between either sees the flag or is seen here
+        worker->wake.Reset();
+        __atomic_store_n(&worker->sleeping, true, __ATOMIC_SEQ_CST);
+
+        if (__atomic_load_n(&this->pending, __ATOMIC_SEQ_CST) > 0 || !__atomic_load_n(&this->running, __ATOMIC_SEQ_CST)) {
+            __atomic_store_n(&worker->sleeping, false, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        worker->wake.Wait();
+        __atomic_store_n(&worker->sleeping, false, __ATOMIC_RELAXED);
+        idleRounds = 0;
+    }
+
+    currentWorker = nullptr;
+}
+
+}
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Scoped.hh>
+#include <Cell/Memory/UnownedBlock.hh>
+#include <Cell/System/LogSinks.hh>
+
+namespace Cell::System {
+
+// Formats a message as a line of text, i.e. "[seconds.microseconds] Level: message".
+CELL_FUNCTION_INTERNAL String FormatLine(const LogLevel level, const uint64_t timestamp, const String& message) {
+    char fraction[8] = { 0 };
+
+    uint64_t microseconds = timestamp % 1000000;
+    for (int i = 5; i >= 0; i--) {
+        fraction[i] = (char)('0' + microseconds % 10);
+        microseconds /= 10;
+    }
+
+    String line = String::Format("[%.%] %: ", timestamp / 1000000, (const char*)fraction, GetLogLevelName(level));
+    line += message;
+
+    return line;
+}
+
+const char* GetLogLevelName(const LogLevel level) {
+    switch (level) {
+    case LogLevel::Debug: {
+        return "Debug";
+    }
+
+    case LogLevel::Info: {
+        return "Info";
+    }
+
+    case LogLevel::Warning: {
+        return "Warning";
+    }
+
+    case LogLevel::Error: {
+        return "Error";
+    }
+
+    default: {
+        return "Unknown";
+    }
+    }
+}
+
+ConsoleLogSink::ConsoleLogSink(const LogLevel minimumLevel) : minimumLevel(minimumLevel) { }
+
+void ConsoleLogSink::Write(const LogLevel level, const uint64_t timestamp, const String& message) {
+    if (level < this->minimumLevel) {
+        return;
+    }
+
+    Log(FormatLine(level, timestamp, message));
+}
+
+Wrapped<RotatingFileLogSink*, IO::Result> RotatingFileLogSink::Create(const String& path, const size_t maxSize, const uint32_t fileCount) {
+    if (path.IsEmpty() || maxSize == 0 || fileCount == 0) {
+        return IO::Result::InvalidParameters;
+    }
+
+    Wrapped<IO::File*, IO::Result> fileResult = OpenFile(path, 0);
+    if (!fileResult.IsValid()) {
+        return fileResult.Result();
+    }
+
+    return new RotatingFileLogSink(path, maxSize, fileCount, fileResult.Unwrap());
+}
+
+RotatingFileLogSink::~RotatingFileLogSink() {
+    if (this->file != nullptr) {
+        this->file->Flush();
+        delete this->file;
+    }
+}
+
+void RotatingFileLogSink::Write(const LogLevel level, const uint64_t timestamp, const String& message) {
+    String line = FormatLine(level, timestamp, message);
+    line += "\n";
+
+    const size_t size = line.GetSize();
+
+    // a message larger than the limit gets a file of its own, rather than being dropped
+    if (this->written > 0 && this->written + size > this->maxSize) {
+        if (this->file != nullptr) {
+            this->file->Flush();
+            delete this->file;
+        }
+
+        this->index = (this->index + 1) % this->fileCount;
+        this->written = 0;
+
+        // should the next file be unavailable, messages are dropped until it's time to move on again
+        Wrapped<IO::File*, IO::Result> fileResult = OpenFile(this->path, this->index);
+        this->file = fileResult.IsValid() ? fileResult.Unwrap() : nullptr;
+    }
+
+    if (this->file != nullptr) {
+        const IO::Result result = this->file->Write(Memory::UnownedBlock<char> { line.ToRawPointer(), size });
+        (void)(result);
+    }
+
+    this->written += size;
+}
+
+void RotatingFileLogSink::Flush() {
+    if (this->file != nullptr) {
+        this->file->Flush();
+    }
+}
+
+Wrapped<IO::File*, IO::Result> RotatingFileLogSink::OpenFile(const String& path, const uint32_t index) {
+    return IO::File::Create(String::Format("%.%", path, index), IO::FileMode::Write | IO::FileMode::Overwrite);
+}
+
+MemoryLogSink::MemoryLogSink(const size_t capacity) : capacity(capacity) {
+    CELL_ASSERT(capacity > 0);
+
+    this->messages.Reserve(capacity);
+}
+
+void MemoryLogSink::Write(const LogLevel level, const uint64_t timestamp, const String& message) {
+    String line = FormatLine(level, timestamp, message);
+
+    this->lock.Lock();
+
+    if (this->messages.GetCount() < this->capacity) {
+        this->messages.Append(line);
+    } else {
+        this->messages[this->next] = line;
+    }
+
+    this->next = (this->next + 1) % this->capacity;
+
+    this->lock.Unlock();
+}
+
+Collection::List<String> MemoryLogSink::GetMessages() {
+    this->lock.Lock();
+
+    // once full, the oldest message is the one to be overwritten next
+    const size_t count = this->messages.GetCount();
+    const size_t start = count < this->capacity ? 0 : this->next;
+
+    Collection::List<String> copy;
+    copy.Reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        copy.Append(this->messages[(start + i) % count]);
+    }
+
+    this->lock.Unlock();
+    return copy;
+}
+
+}
@@ -0,0 +1,462 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Collection/RingBuffer.hh>
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Logger.hh>
+#include <Cell/System/Thread.hh>
+#include <Cell/System/Ticks.hh>
+
+#include <string.h>
+#include <wchar.h>
+
+namespace Cell::System {
+
+namespace LoggerDetails {
+
+using namespace StringDetails::Formatting;
+
+// Largest number of bytes a single message takes up in a buffer; longer strings are cut short.
+constexpr size_t MaxRecordSize = 1024;
+
+// Bytes kept free for every argument after the current one, so later arguments always fit their header and an empty string.
+constexpr size_t ArgumentReserve = 24;
+
+// Time in milliseconds the logger thread waits for more messages, unless it's woken up earlier by a buffer filling up.
+constexpr uint32_t PollInterval = 5;
+
+// Captured message, followed by its arguments. Records are padded to multiples of 8 bytes.
+struct Record {
+    const char* format;
+    uint64_t ticks;
+    uint32_t size;
+    uint8_t count;
+    LogLevel level;
+};
+
+// Captured argument; strings follow it, including their terminator, and padded as well.
+struct Argument {
+    Type type;
+    uint32_t length;
+    uint64_t value;
+};
+
+struct Buffer : public Object {
+    CELL_FUNCTION_INTERNAL explicit Buffer(const size_t size) : ring(size) { }
+
+    Collection::RingBuffer<uint8_t> ring;
+
+    // messages that didn't fit, counted by the owning thread, and how many of them the logger thread has reported
+    uint64_t dropped = 0;
+    uint64_t reported = 0;
+
+    Buffer* next = nullptr;
+};
+
+// Position of the oldest unwritten record of a buffer, while the logger thread merges them.
+struct Cursor {
+    size_t offset;
+    size_t end;
+};
+
+static Logger* activeLogger = nullptr;
+static uint64_t lastGeneration = 0;
+
+// the buffer the calling thread logs to, and which logger it belongs to
+static thread_local Buffer* currentBuffer = nullptr;
+static thread_local uint64_t currentGeneration = 0;
+
+CELL_FUNCTION_INTERNAL size_t Pad(const size_t size) {
+    return (size + 7) & ~(size_t)7;
+}
+
+}
+
+using namespace LoggerDetails;
+
+void LogDetails::Submit(const LogLevel level, const char* format, const Data* arguments, const size_t count) {
+    Logger* logger = __atomic_load_n(&activeLogger, __ATOMIC_ACQUIRE);
+    if (logger == nullptr) {
+        (void)(level);
+
+        Log(Logger::Format(format, arguments, count));
+        return;
+    }
+
+    logger->Enqueue(level, format, arguments, count);
+}
+
+Logger::Logger(const size_t bufferSize) : bufferSize(bufferSize) {
+    CELL_ASSERT(bufferSize >= MaxRecordSize);
+
+    this->generation = __atomic_add_fetch(&lastGeneration, 1, __ATOMIC_RELAXED);
+    this->startTicks = GetTicks();
+
+    this->thread = new Thread(CELL_THREAD_CLASS_FUNC(Logger, Run), "Cell Logger");
+
+    Logger* expected = nullptr;
+    const bool activated = __atomic_compare_exchange_n(&activeLogger, &expected, this, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    CELL_ASSERT(activated);
+}
+
+Logger::~Logger() {
+    __atomic_store_n(&activeLogger, nullptr, __ATOMIC_RELEASE);
+
+    __atomic_store_n(&this->running, false, __ATOMIC_SEQ_CST);
+    this->wake.Signal();
+
+    this->thread->Join();
+    delete this->thread;
+
+    // the thread may have stopped with messages still queued
+    while (this->Drain()) { }
+    this->FlushSinks();
+
+    Buffer* buffer = this->buffers;
+    while (buffer != nullptr) {
+        Buffer* next = buffer->next;
+        delete buffer;
+
+        buffer = next;
+    }
+}
+
+void Logger::AddSink(ILogSink* sink) {
+    this->sinkLock.Lock();
+    this->sinks.Append(sink);
+    this->sinkLock.Unlock();
+}
+
+void Logger::Flush() {
+    const uint32_t request = __atomic_add_fetch(&this->flushRequests, 1, __ATOMIC_SEQ_CST);
+    this->wake.Signal();
+
+    while (true) {
+        const uint32_t done = __atomic_load_n(&this->flushedThrough, __ATOMIC_ACQUIRE);
+        if ((int32_t)(done - request) >= 0) {
+            return;
+        }
+
+        FutexWait(&this->flushedThrough, done);
+    }
+}
+
+uint64_t Logger::GetDroppedCount() const {
+    return __atomic_load_n(&this->dropped, __ATOMIC_RELAXED);
+}
+
+void Logger::Enqueue(const LogLevel level, const char* format, const Data* arguments, const size_t count) {
+    CELL_ASSERT(count <= LogDetails::MaxArguments);
+
+    Buffer* buffer = this->GetBuffer();
+
+    alignas(8) uint8_t data[MaxRecordSize];
+
+    Record* record = (Record*)data;
+    record->format = format;
+    record->ticks = GetTicks();
+    record->count = (uint8_t)count;
+    record->level = level;
+
+    size_t offset = sizeof(Record);
+    for (size_t i = 0; i < count; i++) {
+        Argument* argument = (Argument*)(data + offset);
+        argument->type = arguments[i].type;
+        argument->length = 0;
+        argument->value = 0;
+
+        offset += sizeof(Argument);
+
+        const void* text = nullptr;
+        size_t length = 0;
+        size_t characterSize = 1;
+
+        switch (arguments[i].type) {
+        case Type::Int: {
+            argument->value = (uint64_t)arguments[i].sInt;
+            break;
+        }
+
+        case Type::UInt: {
+            argument->value = arguments[i].uInt;
+            break;
+        }
+
+        case Type::Address: {
+            argument->value = (uintptr_t)arguments[i].address;
+            break;
+        }
+
+        case Type::FloatingPoint:
+        case Type::SingleFloatingPoint: {
+            Memory::Copy(&argument->value, &arguments[i].floatingPoint, sizeof(double));
+            break;
+        }
+
+        case Type::ConstCharPointer: {
+            text = arguments[i].constCharPointer;
+            length = strlen(arguments[i].constCharPointer);
+            break;
+        }
+
+        case Type::ConstWideCharPointer: {
+            text = arguments[i].constWideCharPointer;
+            length = wcslen(arguments[i].constWideCharPointer);
+            characterSize = sizeof(wchar_t);
+            break;
+        }
+
+        case Type::CellString: {
+            // stored as plain text, so the logger thread doesn't have to create a string for it
+            const String& string = arguments[i].string.Unwrap();
+
+            argument->type = Type::ConstCharPointer;
+            text = string.ToRawPointer();
+            length = string.GetSize();
+            break;
+        }
+
+        case Type::CellStringView: {
+            argument->type = Type::ConstCharPointer;
+            text = arguments[i].view.text;
+            length = arguments[i].view.size;
+            break;
+        }
+        }
+
+        if (argument->type != Type::ConstCharPointer && argument->type != Type::ConstWideCharPointer) {
+            continue;
+        }
+
+        const size_t available = (MaxRecordSize - offset - (count - i - 1) * ArgumentReserve) / characterSize - 1;
+        if (length > available) {
+            length = available;
+
+            // don't cut UTF-8 sequences in half
+            while (characterSize == 1 && length > 0 && (((const uint8_t*)text)[length] & 0xc0) == 0x80) {
+                length--;
+            }
+        }
+
+        if (length > 0) {
+            Memory::Copy(data + offset, text, length * characterSize);
+        }
+
+        Memory::Clear(data + offset + length * characterSize, characterSize);
+
+        argument->length = (uint32_t)((length + 1) * characterSize);
+        offset += Pad(argument->length);
+    }
+
+    record->size = (uint32_t)offset;
+
+    Collection::RingBuffer<uint8_t>& ring = buffer->ring;
+    if (ring.GetCapacity() - ring.GetCount() < offset) {
+        __atomic_store_n(&buffer->dropped, buffer->dropped + 1, __ATOMIC_RELAXED);
+        this->wake.Signal();
+        return;
+    }
+
+    ring.PushMany(data, offset);
+
+    // the logger thread polls anyway; it's only hurried along when the buffer is about to run full, or for errors
+    if (level == LogLevel::Error || ring.GetCount() > ring.GetCapacity() / 2) {
+        this->wake.Signal();
+    }
+}
+
+Buffer* Logger::GetBuffer() {
+    if (currentGeneration == this->generation) {
+        return currentBuffer;
+    }
+
+    Buffer* buffer = new Buffer(this->bufferSize);
+
+    buffer->next = __atomic_load_n(&this->buffers, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&this->buffers, &buffer->next, buffer, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) { }
+
+    currentBuffer = buffer;
+    currentGeneration = this->generation;
+
+    return buffer;
+}
+
+void Logger::Run() {
+    while (__atomic_load_n(&this->running, __ATOMIC_SEQ_CST)) {
+        const uint32_t requests = __atomic_load_n(&this->flushRequests, __ATOMIC_SEQ_CST);
+        if (this->Drain()) {
+            continue;
+        }
+
+        // caught up with everything logged before the requests were read
+        this->FlushSinks();
+
+        if (__atomic_load_n(&this->flushedThrough, __ATOMIC_RELAXED) != requests) {
+            __atomic_store_n(&this->flushedThrough, requests, __ATOMIC_RELEASE);
+            FutexWakeAll(&this->flushedThrough);
+        }
+
+        // reset before checking for requests, so one coming in right after still wakes this up
+        this->wake.Reset();
+        if (__atomic_load_n(&this->flushRequests, __ATOMIC_SEQ_CST) == requests) {
+            this->wake.Wait(PollInterval);
+        }
+    }
+}
+
+bool Logger::Drain() {
+    Collection::List<Cursor> runs;
+    this->records.SetCount(0);
+
+    uint64_t newlyDropped = 0;
+    for (Buffer* buffer = __atomic_load_n(&this->buffers, __ATOMIC_ACQUIRE); buffer != nullptr; buffer = buffer->next) {
+        const uint64_t dropped = __atomic_load_n(&buffer->dropped, __ATOMIC_RELAXED);
+        newlyDropped += dropped - buffer->reported;
+        buffer->reported = dropped;
+
+        // records are published whole, so whatever's there is a number of complete records
+        const size_t available = buffer->ring.GetCount();
+        if (available == 0) {
+            continue;
+        }
+
+        const size_t offset = this->records.GetCount();
+        if (offset + available > this->records.GetCapacity()) {
+            this->records.Reserve((offset + available) * 2);
+        }
+
+        this->records.SetCount(offset + available);
+        buffer->ring.PopMany(this->records.begin() + offset, available);
+
+        runs.Append({ .offset = offset, .end = offset + available });
+    }
+
+    if (newlyDropped > 0) {
+        __atomic_fetch_add(&this->dropped, newlyDropped, __ATOMIC_RELAXED);
+        this->Write(LogLevel::Warning, TicksToMicroseconds(GetTicks() - this->startTicks),
+                    String::Format("Dropped % log messages, as their buffers were full", newlyDropped));
+    }
+
+    if (runs.IsEmpty()) {
+        return newlyDropped > 0;
+    }
+
+    // every buffer is in order already, so they only have to be merged; there are rarely more than a handful
+    while (true) {
+        Cursor* oldest = nullptr;
+        const Record* oldestRecord = nullptr;
+
+        for (Cursor& run : runs) {
+            if (run.offset == run.end) {
+                continue;
+            }
+
+            const Record* record = (const Record*)(this->records.begin() + run.offset);
+            if (oldestRecord == nullptr || record->ticks < oldestRecord->ticks) {
+                oldest = &run;
+                oldestRecord = record;
+            }
+        }
+
+        if (oldest == nullptr) {
+            break;
+        }
+
+        oldest->offset += oldestRecord->size;
+
+        const uint64_t ticks = oldestRecord->ticks > this->startTicks ? oldestRecord->ticks - this->startTicks : 0;
+        this->Write(oldestRecord->level, TicksToMicroseconds(ticks), Logger::Format(oldestRecord));
+    }
+
+    return true;
+}
+
+void Logger::Write(const LogLevel level, const uint64_t timestamp, const String& message) {
+    this->sinkLock.Lock();
+
+    for (ILogSink* sink : this->sinks) {
+        sink->Write(level, timestamp, message);
+    }
+
+    this->sinkLock.Unlock();
+}
+
+void Logger::FlushSinks() {
+    this->sinkLock.Lock();
+
+    for (ILogSink* sink : this->sinks) {
+        sink->Flush();
+    }
+
+    this->sinkLock.Unlock();
+}
+
+String Logger::Format(const char* format, const Data* arguments, const size_t count) {
+    // without arguments, the format is taken as is, like a plain message
+    if (count == 0) {
+        return String(format);
+    }
+
+    return String::FormatImplementation(format, strlen(format), nullptr, arguments, count);
+}
+
+String Logger::Format(const Record* record) {
+    if (record->count == 0) {
+        return String(record->format);
+    }
+
+    alignas(Data) uint8_t storage[sizeof(Data) * LogDetails::MaxArguments];
+    Data* data = (Data*)storage;
+
+    const uint8_t* cursor = (const uint8_t*)(record + 1);
+    for (size_t i = 0; i < record->count; i++) {
+        const Argument* argument = (const Argument*)cursor;
+        cursor += sizeof(Argument);
+
+        switch (argument->type) {
+        case Type::Int: {
+            Memory::Construct<Data>(data + i, Data { .type = Type::Int, .sInt = (signed long long)argument->value });
+            break;
+        }
+
+        case Type::UInt: {
+            Memory::Construct<Data>(data + i, Data { .type = Type::UInt, .uInt = argument->value });
+            break;
+        }
+
+        case Type::Address: {
+            Memory::Construct<Data>(data + i, Data { .type = Type::Address, .address = (const void*)(uintptr_t)argument->value });
+            break;
+        }
+
+        case Type::FloatingPoint:
+        case Type::SingleFloatingPoint: {
+            double value = 0.0;
+            Memory::Copy(&value, &argument->value, sizeof(double));
+
+            Memory::Construct<Data>(data + i, Data { .type = argument->type, .floatingPoint = value });
+            break;
+        }
+
+        case Type::ConstCharPointer: {
+            Memory::Construct<Data>(data + i, Data { .type = Type::ConstCharPointer, .constCharPointer = (const char*)cursor });
+            break;
+        }
+
+        case Type::ConstWideCharPointer: {
+            Memory::Construct<Data>(data + i, Data { .type = Type::ConstWideCharPointer, .constWideCharPointer = (const wchar_t*)cursor });
+            break;
+        }
+
+        default: {
+            System::Panic("Malformed log record");
+        }
+        }
+
+        cursor += Pad(argument->length);
+    }
+
+    return Logger::Format(record->format, data, record->count);
+}
+
+}
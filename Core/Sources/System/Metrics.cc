@@ -0,0 +1,352 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Metrics.hh>
+#include <Cell/System/Mutex.hh>
+
+#include <stdio.h>
+#include <string.h>
+
+namespace Cell::System {
+
+namespace MetricsDetails {
+
+struct HistogramShard {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t minimum;
+    uint64_t maximum;
+
+    uint64_t buckets[BucketCount];
+};
+
+// Percentiles given in exports, along with their names.
+static const struct {
+    double percentile;
+    const char* name;
+} exportedPercentiles[] = {
+    { 50.0, "p50" },
+    { 90.0, "p90" },
+    { 99.0, "p99" },
+    { 99.9, "p999" }
+};
+
+// registered metrics, as a list; the lock only guards its structure, values are read without it
+static Mutex registryLock;
+static Metric* firstMetric = nullptr;
+
+static uint32_t nextShard = 0;
+
+CELL_FUNCTION_INTERNAL void UpdateMinimum(uint64_t& target, const uint64_t value) {
+    uint64_t current = __atomic_load_n(&target, __ATOMIC_RELAXED);
+    while (value < current && !__atomic_compare_exchange_n(&target, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) { }
+}
+
+CELL_FUNCTION_INTERNAL void UpdateMaximum(uint64_t& target, const uint64_t value) {
+    uint64_t current = __atomic_load_n(&target, __ATOMIC_RELAXED);
+    while (value > current && !__atomic_compare_exchange_n(&target, &current, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) { }
+}
+
+CELL_FUNCTION_INTERNAL void ClearShard(HistogramShard* shard) {
+    __atomic_store_n(&shard->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&shard->sum, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&shard->minimum, UINT64_MAX, __ATOMIC_RELAXED);
+    __atomic_store_n(&shard->maximum, 0, __ATOMIC_RELAXED);
+
+    for (size_t i = 0; i < BucketCount; i++) {
+        __atomic_store_n(&shard->buckets[i], 0, __ATOMIC_RELAXED);
+    }
+}
+
+CELL_FUNCTION_INTERNAL void AppendJSONName(String& output, const char* name) {
+    output += "\"";
+
+    // names are meant to be plain identifiers, so anything that would need escaping is replaced
+    for (const char* character = name; *character != '\0'; character++) {
+        const char text[2] = { *character == '"' || *character == '\\' || (uint8_t)*character < 0x20 ? '_' : *character, '\0' };
+        output += text;
+    }
+
+    output += "\"";
+}
+
+}
+
+using namespace MetricsDetails;
+
+uint32_t MetricsDetails::AssignShard() {
+    return __atomic_fetch_add(&nextShard, 1, __ATOMIC_RELAXED) % ShardCount;
+}
+
+Metric::Metric(const char* name, const MetricType type) : name(name), type(type) {
+    MetricRegistry::Register(this);
+}
+
+Metric::~Metric() {
+    MetricRegistry::Unregister(this);
+}
+
+uint64_t MetricCounter::GetValue() const {
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < ShardCount; i++) {
+        value += __atomic_load_n(&this->shards[i].value, __ATOMIC_RELAXED);
+    }
+
+    return value;
+}
+
+MetricHistogram::~MetricHistogram() {
+    for (uint32_t i = 0; i < ShardCount; i++) {
+        if (this->shards[i] != nullptr) {
+            Memory::FreeAligned(this->shards[i]);
+        }
+    }
+}
+
+void MetricHistogram::Record(const uint64_t value) {
+    const uint32_t index = GetShard();
+
+    HistogramShard* shard = __atomic_load_n(&this->shards[index], __ATOMIC_ACQUIRE);
+    if (shard == nullptr) {
+        HistogramShard* created = Memory::AllocateAligned<HistogramShard>(1, Memory::CacheLineSize);
+        ClearShard(created);
+
+        // another thread on the same shard may have been quicker
+        if (__atomic_compare_exchange_n(&this->shards[index], &shard, created, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            shard = created;
+        } else {
+            Memory::FreeAligned(created);
+        }
+    }
+
+    __atomic_fetch_add(&shard->buckets[GetBucket(value)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&shard->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&shard->sum, value, __ATOMIC_RELAXED);
+
+    UpdateMinimum(shard->minimum, value);
+    UpdateMaximum(shard->maximum, value);
+}
+
+HistogramSnapshot MetricHistogram::Snapshot() const {
+    HistogramSnapshot snapshot = { .count = 0, .sum = 0, .minimum = UINT64_MAX, .maximum = 0, .buckets = Collection::List<uint64_t>(0, BucketCount) };
+
+    for (uint32_t i = 0; i < ShardCount; i++) {
+        HistogramShard* shard = __atomic_load_n(&this->shards[i], __ATOMIC_ACQUIRE);
+        if (shard == nullptr) {
+            continue;
+        }
+
+        for (size_t j = 0; j < BucketCount; j++) {
+            snapshot.buckets[j] += __atomic_load_n(&shard->buckets[j], __ATOMIC_RELAXED);
+        }
+
+        snapshot.sum += __atomic_load_n(&shard->sum, __ATOMIC_RELAXED);
+
+        const uint64_t minimum = __atomic_load_n(&shard->minimum, __ATOMIC_RELAXED);
+        const uint64_t maximum = __atomic_load_n(&shard->maximum, __ATOMIC_RELAXED);
+
+        snapshot.minimum = minimum < snapshot.minimum ? minimum : snapshot.minimum;
+        snapshot.maximum = maximum > snapshot.maximum ? maximum : snapshot.maximum;
+    }
+
+    // counted from the buckets, so percentiles always add up, even with values recorded meanwhile
+    for (size_t i = 0; i < BucketCount; i++) {
+        snapshot.count += snapshot.buckets[i];
+    }
+
+    if (snapshot.count == 0) {
+        snapshot.minimum = 0;
+    }
+
+    return snapshot;
+}
+
+void MetricHistogram::Reset() {
+    for (uint32_t i = 0; i < ShardCount; i++) {
+        HistogramShard* shard = __atomic_load_n(&this->shards[i], __ATOMIC_ACQUIRE);
+        if (shard != nullptr) {
+            ClearShard(shard);
+        }
+    }
+}
+
+uint64_t HistogramSnapshot::GetPercentile(const double percentile) const {
+    if (this->count == 0) {
+        return 0;
+    }
+
+    const double clamped = percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile);
+
+    uint64_t rank = (uint64_t)(clamped / 100.0 * (double)this->count + 0.5);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < this->buckets.GetCount(); i++) {
+        seen += this->buckets[i];
+        if (seen < rank) {
+            continue;
+        }
+
+        // the top of the bucket, as no value in it is larger; nor is any value larger than the maximum
+        const uint64_t limit = MetricsDetails::GetBucketLimit(i);
+        return limit < this->maximum ? (limit > this->minimum ? limit : this->minimum) : this->maximum;
+    }
+
+    return this->maximum;
+}
+
+Metric* MetricRegistry::Find(const char* name) {
+    registryLock.Lock();
+
+    Metric* metric = firstMetric;
+    while (metric != nullptr && strcmp(metric->name, name) != 0) {
+        metric = metric->next;
+    }
+
+    registryLock.Unlock();
+    return metric;
+}
+
+String MetricRegistry::ExportText() {
+    String output;
+    char buffer[128];
+
+    registryLock.Lock();
+
+    for (Metric* metric = firstMetric; metric != nullptr; metric = metric->next) {
+        switch (metric->type) {
+        case MetricType::Counter: {
+            snprintf(buffer, sizeof(buffer), "counter %s %llu\n", metric->name, (unsigned long long)((MetricCounter*)metric)->GetValue());
+            output += buffer;
+            break;
+        }
+
+        case MetricType::Gauge: {
+            snprintf(buffer, sizeof(buffer), "gauge %s %g\n", metric->name, ((MetricGauge*)metric)->GetValue());
+            output += buffer;
+            break;
+        }
+
+        case MetricType::Histogram: {
+            const HistogramSnapshot snapshot = ((MetricHistogram*)metric)->Snapshot();
+
+            snprintf(buffer, sizeof(buffer), "histogram %s count=%llu min=%llu mean=%.1f", metric->name, (unsigned long long)snapshot.count,
+                     (unsigned long long)snapshot.minimum, snapshot.GetMean());
+            output += buffer;
+
+            for (const auto& entry : exportedPercentiles) {
+                snprintf(buffer, sizeof(buffer), " %s=%llu", entry.name, (unsigned long long)snapshot.GetPercentile(entry.percentile));
+                output += buffer;
+            }
+
+            snprintf(buffer, sizeof(buffer), " max=%llu\n", (unsigned long long)snapshot.maximum);
+            output += buffer;
+            break;
+        }
+        }
+    }
+
+    registryLock.Unlock();
+    return output;
+}
+
+String MetricRegistry::ExportJSON() {
+    String counters;
+    String gauges;
+    String histograms;
+    char buffer[128];
+
+    registryLock.Lock();
+
+    for (Metric* metric = firstMetric; metric != nullptr; metric = metric->next) {
+        switch (metric->type) {
+        case MetricType::Counter: {
+            counters += counters.IsEmpty() ? "" : ",";
+            AppendJSONName(counters, metric->name);
+
+            snprintf(buffer, sizeof(buffer), ":%llu", (unsigned long long)((MetricCounter*)metric)->GetValue());
+            counters += buffer;
+            break;
+        }
+
+        case MetricType::Gauge: {
+            const double value = ((MetricGauge*)metric)->GetValue();
+
+            gauges += gauges.IsEmpty() ? "" : ",";
+            AppendJSONName(gauges, metric->name);
+
+            // JSON has no room for infinities, or anything that's not a number
+            snprintf(buffer, sizeof(buffer), ":%.17g", __builtin_isfinite(value) ? value : 0.0);
+            gauges += buffer;
+            break;
+        }
+
+        case MetricType::Histogram: {
+            const HistogramSnapshot snapshot = ((MetricHistogram*)metric)->Snapshot();
+
+            histograms += histograms.IsEmpty() ? "" : ",";
+            AppendJSONName(histograms, metric->name);
+
+            snprintf(buffer, sizeof(buffer), ":{\"count\":%llu,\"min\":%llu,\"mean\":%.17g", (unsigned long long)snapshot.count,
+                     (unsigned long long)snapshot.minimum, snapshot.GetMean());
+            histograms += buffer;
+
+            for (const auto& entry : exportedPercentiles) {
+                snprintf(buffer, sizeof(buffer), ",\"%s\":%llu", entry.name, (unsigned long long)snapshot.GetPercentile(entry.percentile));
+                histograms += buffer;
+            }
+
+            snprintf(buffer, sizeof(buffer), ",\"max\":%llu}", (unsigned long long)snapshot.maximum);
+            histograms += buffer;
+            break;
+        }
+        }
+    }
+
+    registryLock.Unlock();
+
+    String output = "{\"counters\":{";
+    output += counters;
+    output += "},\"gauges\":{";
+    output += gauges;
+    output += "},\"histograms\":{";
+    output += histograms;
+    output += "}}";
+
+    return output;
+}
+
+void MetricRegistry::Register(Metric* metric) {
+    registryLock.Lock();
+
+    // appended, so exports list metrics in the order they came up
+    Metric** link = &firstMetric;
+    while (*link != nullptr) {
+        metric->previous = *link;
+        link = &(*link)->next;
+    }
+
+    *link = metric;
+
+    registryLock.Unlock();
+}
+
+void MetricRegistry::Unregister(Metric* metric) {
+    registryLock.Lock();
+
+    if (metric->previous != nullptr) {
+        metric->previous->next = metric->next;
+    } else {
+        firstMetric = metric->next;
+    }
+
+    if (metric->next != nullptr) {
+        metric->next->previous = metric->previous;
+    }
+
+    registryLock.Unlock();
+}
+
+}
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Mutex.hh>
+
+namespace Cell::System {
+
+// Number of times a contended lock is retried before sleeping; about as long as a short critical section takes.
+constexpr uint32_t MutexSpinCount = 100;
+
+void Mutex::LockContended() {
+    for (uint32_t i = 0; i < MutexSpinCount; i++) {
+        uint32_t state = __atomic_load_n(&this->state, __ATOMIC_RELAXED);
+        if (state == LockedWithWaiters) {
+            // others are already asleep, spinning won't get ahead of them
+            break;
+        }
+
+        if (state == Unlocked && __atomic_compare_exchange_n(&this->state, &state, Locked, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return;
+        }
+
+        CpuRelax();
+    }
+
+    // from here on, the lock is only ever taken as contended, as there's no telling whether other threads are still asleep
+    while (__atomic_exchange_n(&this->state, LockedWithWaiters, __ATOMIC_ACQUIRE) != Unlocked) {
+        FutexWait(&this->state, LockedWithWaiters);
+    }
+}
+
+void Mutex::WakeWaiter() {
+    FutexWake(&this->state);
+}
+
+}
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/PerfCounters.hh>
+
+#include <stdio.h>
+
+namespace Cell::System {
+
+String PerfSample::ToString(const uint64_t elements) const {
+    String output;
+    char buffer[96];
+
+    if (this->IsAvailable(PerfCounter::Cycles) && this->IsAvailable(PerfCounter::Instructions)) {
+        snprintf(buffer, sizeof(buffer), "%.2f IPC", this->GetInstructionsPerCycle());
+        output += buffer;
+    }
+
+    static const struct {
+        PerfCounter counter;
+        const char* name;
+    } perElement[] = {
+        { PerfCounter::Cycles,       "cycles" },
+        { PerfCounter::CacheMisses,  "cache misses" },
+        { PerfCounter::BranchMisses, "branch misses" },
+        { PerfCounter::PageFaults,   "page faults" }
+    };
+
+    for (const auto& entry : perElement) {
+        if (!this->IsAvailable(entry.counter)) {
+            continue;
+        }
+
+        snprintf(buffer, sizeof(buffer), "%s%.3f %s/element", output.IsEmpty() ? "" : ", ", this->GetPerElement(entry.counter, elements), entry.name);
+        output += buffer;
+    }
+
+    if (output.IsEmpty()) {
+        output = "no counters available";
+    }
+
+    return output;
+}
+
+}
@@ -0,0 +1,546 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/IO/File.hh>
+#include <Cell/System/Profiler.hh>
+#include <Cell/System/Thread.hh>
+#include <Cell/System/Ticks.hh>
+
+#include <stdio.h>
+#include <string.h>
+
+namespace Cell::System {
+
+namespace ProfilerDetails {
+
+// Process ID given in traces; captures only ever cover the calling process.
+constexpr uint64_t ProcessId = 1;
+
+// Set in the ticks of events holding a counter value, which is stored in the event following it.
+constexpr uint64_t CounterFlag = 1ull << 63;
+
+// Protobuf wire types used by Perfetto traces.
+enum class WireType : uint8_t {
+    Varint = 0,
+    Fixed64 = 1,
+    Length = 2
+};
+
+// Field numbers of the Perfetto messages that are written.
+constexpr uint32_t TracePacketField = 1;           // Trace.packet
+
+constexpr uint32_t TimestampField = 8;             // TracePacket.timestamp
+constexpr uint32_t SequenceField = 10;             // TracePacket.trusted_packet_sequence_id
+constexpr uint32_t TrackEventField = 11;           // TracePacket.track_event
+constexpr uint32_t TrackDescriptorField = 60;      // TracePacket.track_descriptor
+
+constexpr uint32_t EventTypeField = 9;             // TrackEvent.type
+constexpr uint32_t EventTrackField = 11;           // TrackEvent.track_uuid
+constexpr uint32_t EventNameField = 23;            // TrackEvent.name
+constexpr uint32_t EventDoubleValueField = 44;     // TrackEvent.double_counter_value
+
+constexpr uint32_t TrackUUIDField = 1;             // TrackDescriptor.uuid
+constexpr uint32_t TrackNameField = 2;             // TrackDescriptor.name
+constexpr uint32_t TrackThreadField = 4;           // TrackDescriptor.thread
+constexpr uint32_t TrackParentField = 5;           // TrackDescriptor.parent_uuid
+constexpr uint32_t TrackCounterField = 8;          // TrackDescriptor.counter
+
+constexpr uint32_t ThreadProcessField = 1;         // ThreadDescriptor.pid
+constexpr uint32_t ThreadIdField = 2;              // ThreadDescriptor.tid
+
+// TrackEvent.Type values.
+constexpr uint64_t SliceBegin = 1;
+constexpr uint64_t SliceEnd = 2;
+constexpr uint64_t CounterValue = 4;
+
+// Beginning of a scope, its end if it has no name, or a counter value.
+struct Event {
+    const char* name;
+    uint64_t ticks;
+};
+
+// Series and value of a counter, stored in place of the event after the one with its name.
+struct CounterEntry {
+    const char* key;
+    double value;
+};
+
+CELL_STATIC_ASSERT(sizeof(CounterEntry) == sizeof(Event));
+
+// Counter series of a thread, while exporting to Perfetto.
+struct CounterTrack {
+    const char* name;
+    const char* key;
+    uint64_t uuid;
+};
+
+struct Buffer : public Object {
+    CELL_FUNCTION_INTERNAL Buffer(const size_t capacity, const uint64_t thread)
+        : events(Memory::AllocateUninitialized<Event>(capacity)), capacity(capacity), thread(thread) { }
+
+    CELL_FUNCTION_INTERNAL ~Buffer() {
+        Memory::Free(this->events);
+    }
+
+    Event* events;
+    size_t capacity;
+    uint64_t thread;
+
+    // capture the events belong to, and how many there are; only the owning thread writes either
+    uint64_t capture = 0;
+    size_t count = 0;
+
+    // scopes begun but not ended, each holding on to room for its end
+    size_t open = 0;
+
+    uint64_t dropped = 0;
+
+    Buffer* next = nullptr;
+};
+
+static Profiler* activeProfiler = nullptr;
+static uint64_t lastGeneration = 0;
+
+// captures are numbered across profilers, so tokens never match a capture they weren't taken in
+static uint64_t captureCounter = 0;
+
+// the buffer the calling thread records to, and which profiler it belongs to
+static thread_local Buffer* currentBuffer = nullptr;
+static thread_local uint64_t currentGeneration = 0;
+
+CELL_FUNCTION_INTERNAL void AppendBytes(Collection::List<uint8_t>& output, const void* data, const size_t size) {
+    if (size == 0) {
+        return;
+    }
+
+    const size_t offset = output.GetCount();
+    if (offset + size > output.GetCapacity()) {
+        output.Reserve((offset + size) * 2);
+    }
+
+    output.SetCount(offset + size);
+    Memory::Copy(output.AsRaw() + offset, (const uint8_t*)data, size);
+}
+
+CELL_FUNCTION_INTERNAL void AppendText(Collection::List<uint8_t>& output, const char* text) {
+    AppendBytes(output, text, strlen(text));
+}
+
+CELL_FUNCTION_INTERNAL void AppendJSONString(Collection::List<uint8_t>& output, const char* text) {
+    output.Append('"');
+
+    for (const char* character = text; *character != '\0'; character++) {
+        const uint8_t value = (uint8_t)*character;
+
+        if (value == '"' || value == '\\') {
+            output.Append('\\');
+            output.Append(value);
+        } else if (value < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", value);
+            AppendText(output, escaped);
+        } else {
+            output.Append(value);
+        }
+    }
+
+    output.Append('"');
+}
+
+CELL_FUNCTION_INTERNAL void AppendVarint(Collection::List<uint8_t>& output, uint64_t value) {
+    while (value >= 0x80) {
+        output.Append((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+
+    output.Append((uint8_t)value);
+}
+
+CELL_FUNCTION_INTERNAL void AppendVarintField(Collection::List<uint8_t>& output, const uint32_t field, const uint64_t value) {
+    AppendVarint(output, ((uint64_t)field << 3) | (uint64_t)WireType::Varint);
+    AppendVarint(output, value);
+}
+
+CELL_FUNCTION_INTERNAL void AppendLengthField(Collection::List<uint8_t>& output, const uint32_t field, const void* data, const size_t size) {
+    AppendVarint(output, ((uint64_t)field << 3) | (uint64_t)WireType::Length);
+    AppendVarint(output, size);
+    AppendBytes(output, data, size);
+}
+
+CELL_FUNCTION_INTERNAL void AppendDoubleField(Collection::List<uint8_t>& output, const uint32_t field, const double value) {
+    AppendVarint(output, ((uint64_t)field << 3) | (uint64_t)WireType::Fixed64);
+
+    // fixed size fields are little endian, like every platform supported
+    AppendBytes(output, &value, sizeof(double));
+}
+
+CELL_FUNCTION_INTERNAL void AppendMessageField(Collection::List<uint8_t>& output, const uint32_t field, Collection::List<uint8_t>& message) {
+    AppendLengthField(output, field, message.AsRaw(), message.GetCount());
+}
+
+}
+
+using namespace ProfilerDetails;
+
+uint64_t ProfilerDetails::Begin(const char* name) {
+    Profiler* profiler = __atomic_load_n(&activeProfiler, __ATOMIC_ACQUIRE);
+    if (profiler == nullptr) {
+        return 0;
+    }
+
+    const uint64_t capture = __atomic_load_n(&profiler->capture, __ATOMIC_ACQUIRE);
+    if (capture == 0) {
+        return 0;
+    }
+
+    Buffer* buffer = profiler->GetBuffer(capture);
+
+    const size_t count = buffer->count;
+    if (count + buffer->open + 2 > buffer->capacity) {
+        __atomic_store_n(&buffer->dropped, buffer->dropped + 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+
+    buffer->events[count] = { .name = name, .ticks = GetTicks() };
+    __atomic_store_n(&buffer->count, count + 1, __ATOMIC_RELEASE);
+
+    buffer->open++;
+    return capture;
+}
+
+void ProfilerDetails::End(const uint64_t token) {
+    Profiler* profiler = __atomic_load_n(&activeProfiler, __ATOMIC_ACQUIRE);
+    if (profiler == nullptr || currentGeneration != profiler->generation) {
+        return;
+    }
+
+    // a new capture may have started within the scope, in which case its beginning is gone
+    Buffer* buffer = currentBuffer;
+    if (buffer->capture != token) {
+        return;
+    }
+
+    const size_t count = buffer->count;
+    buffer->events[count] = { .name = nullptr, .ticks = GetTicks() };
+    __atomic_store_n(&buffer->count, count + 1, __ATOMIC_RELEASE);
+
+    buffer->open--;
+}
+
+void ProfilerDetails::Counter(const char* name, const char* key, const double value) {
+    Profiler* profiler = __atomic_load_n(&activeProfiler, __ATOMIC_ACQUIRE);
+    if (profiler == nullptr) {
+        return;
+    }
+
+    const uint64_t capture = __atomic_load_n(&profiler->capture, __ATOMIC_ACQUIRE);
+    if (capture == 0) {
+        return;
+    }
+
+    Buffer* buffer = profiler->GetBuffer(capture);
+
+    const size_t count = buffer->count;
+    if (count + buffer->open + 2 > buffer->capacity) {
+        __atomic_store_n(&buffer->dropped, buffer->dropped + 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    buffer->events[count] = { .name = name, .ticks = GetTicks() | CounterFlag };
+    Memory::Construct<CounterEntry>((CounterEntry*)(buffer->events + count + 1), CounterEntry { .key = key, .value = value });
+
+    __atomic_store_n(&buffer->count, count + 2, __ATOMIC_RELEASE);
+}
+
+Profiler::Profiler(const size_t eventsPerThread) : eventsPerThread(eventsPerThread) {
+    CELL_ASSERT(eventsPerThread >= 2);
+
+    this->generation = __atomic_add_fetch(&lastGeneration, 1, __ATOMIC_RELAXED);
+
+    Profiler* expected = nullptr;
+    const bool activated = __atomic_compare_exchange_n(&activeProfiler, &expected, this, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    CELL_ASSERT(activated);
+}
+
+Profiler::~Profiler() {
+    __atomic_store_n(&activeProfiler, nullptr, __ATOMIC_RELEASE);
+
+    Buffer* buffer = this->buffers;
+    while (buffer != nullptr) {
+        Buffer* next = buffer->next;
+        delete buffer;
+
+        buffer = next;
+    }
+}
+
+void Profiler::Start() {
+    // calibrating takes a while, which shouldn't happen in the middle of a capture
+    (void)(GetTickCalibration());
+
+    const uint64_t capture = __atomic_add_fetch(&captureCounter, 1, __ATOMIC_RELAXED);
+
+    this->startTicks = GetTicks();
+    this->lastCapture = capture;
+
+    __atomic_store_n(&this->capture, capture, __ATOMIC_RELEASE);
+}
+
+void Profiler::Stop() {
+    __atomic_store_n(&this->capture, 0, __ATOMIC_RELEASE);
+}
+
+bool Profiler::IsCapturing() const {
+    return __atomic_load_n(&this->capture, __ATOMIC_RELAXED) != 0;
+}
+
+uint64_t Profiler::GetDroppedCount() const {
+    uint64_t dropped = 0;
+
+    for (Buffer* buffer = __atomic_load_n(&this->buffers, __ATOMIC_ACQUIRE); buffer != nullptr; buffer = buffer->next) {
+        if (__atomic_load_n(&buffer->capture, __ATOMIC_ACQUIRE) == this->lastCapture) {
+            dropped += __atomic_load_n(&buffer->dropped, __ATOMIC_RELAXED);
+        }
+    }
+
+    return dropped;
+}
+
+Collection::List<uint8_t> Profiler::Export(const TraceFormat format) const {
+    Collection::List<uint8_t> output;
+
+    switch (format) {
+    case TraceFormat::Chrome: {
+        this->ExportChrome(output);
+        break;
+    }
+
+    case TraceFormat::Perfetto: {
+        this->ExportPerfetto(output);
+        break;
+    }
+    }
+
+    return output;
+}
+
+IO::Result Profiler::Save(const String& path, const TraceFormat format) const {
+    Collection::List<uint8_t> output = this->Export(format);
+
+    Wrapped<IO::File*, IO::Result> fileResult = IO::File::Create(path, IO::FileMode::Write | IO::FileMode::Overwrite);
+    if (!fileResult.IsValid()) {
+        return fileResult.Result();
+    }
+
+    IO::File* file = fileResult.Unwrap();
+
+    IO::Result result = file->Write(Memory::UnownedBlock<uint8_t> { output.AsRaw(), output.GetCount() });
+    if (result == IO::Result::Success) {
+        result = file->Flush();
+    }
+
+    delete file;
+    return result;
+}
+
+Buffer* Profiler::GetBuffer(const uint64_t capture) {
+    Buffer* buffer = currentBuffer;
+
+    if (currentGeneration != this->generation) {
+        buffer = new Buffer(this->eventsPerThread, Thread::GetCurrentId());
+
+        buffer->next = __atomic_load_n(&this->buffers, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&this->buffers, &buffer->next, buffer, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) { }
+
+        currentBuffer = buffer;
+        currentGeneration = this->generation;
+    }
+
+    // the first event of a capture discards whatever the previous one left behind
+    if (buffer->capture != capture) {
+        __atomic_store_n(&buffer->count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&buffer->dropped, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&buffer->capture, capture, __ATOMIC_RELEASE);
+        buffer->open = 0;
+    }
+
+    return buffer;
+}
+
+void Profiler::ExportChrome(Collection::List<uint8_t>& output) const {
+    const TickCalibration& calibration = GetTickCalibration();
+
+    AppendText(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    bool first = true;
+    for (Buffer* buffer = __atomic_load_n(&this->buffers, __ATOMIC_ACQUIRE); buffer != nullptr; buffer = buffer->next) {
+        if (__atomic_load_n(&buffer->capture, __ATOMIC_ACQUIRE) != this->lastCapture) {
+            continue;
+        }
+
+        const size_t count = __atomic_load_n(&buffer->count, __ATOMIC_ACQUIRE);
+        for (size_t i = 0; i < count; i++) {
+            const Event& event = buffer->events[i];
+
+            const bool isCounter = (event.ticks & CounterFlag) != 0;
+            const uint64_t ticks = event.ticks & ~CounterFlag;
+
+            // timestamps are in microseconds, but fractions are fine
+            const uint64_t nanoseconds = ticks > this->startTicks ? calibration.ToNanoseconds(ticks - this->startTicks) : 0;
+
+            AppendText(output, first ? "{" : ",{");
+            first = false;
+
+            if (event.name != nullptr) {
+                AppendText(output, "\"name\":");
+                AppendJSONString(output, event.name);
+                AppendText(output, ",");
+            }
+
+            char fields[128];
+            snprintf(fields, sizeof(fields), "\"ph\":\"%c\",\"pid\":%llu,\"tid\":%llu,\"ts\":%llu.%03llu", isCounter ? 'C' : event.name != nullptr ? 'B' : 'E',
+                     (unsigned long long)ProcessId, (unsigned long long)buffer->thread, (unsigned long long)(nanoseconds / 1000),
+                     (unsigned long long)(nanoseconds % 1000));
+
+            AppendText(output, fields);
+
+            if (isCounter) {
+                const CounterEntry* entry = (const CounterEntry*)(buffer->events + ++i);
+
+                // JSON has no room for infinities, or anything that's not a number
+                snprintf(fields, sizeof(fields), ":%.9g}", __builtin_isfinite(entry->value) ? entry->value : 0.0);
+
+                AppendText(output, ",\"args\":{");
+                AppendJSONString(output, entry->key);
+                AppendText(output, fields);
+            }
+
+            AppendText(output, "}");
+        }
+    }
+
+    AppendText(output, "]}\n");
+}
+
+void Profiler::ExportPerfetto(Collection::List<uint8_t>& output) const {
+    const TickCalibration& calibration = GetTickCalibration();
+
+    Collection::List<uint8_t> packet;
+    Collection::List<uint8_t> message;
+    Collection::List<uint8_t> nested;
+
+    Collection::List<CounterTrack> counters;
+
+    // every thread gets a track, and a packet sequence of its own, as events are only in order per thread
+    uint64_t sequence = 0;
+    uint64_t lastUUID = 0;
+    for (Buffer* buffer = __atomic_load_n(&this->buffers, __ATOMIC_ACQUIRE); buffer != nullptr; buffer = buffer->next) {
+        if (__atomic_load_n(&buffer->capture, __ATOMIC_ACQUIRE) != this->lastCapture) {
+            continue;
+        }
+
+        const size_t count = __atomic_load_n(&buffer->count, __ATOMIC_ACQUIRE);
+        const uint64_t track = ++lastUUID;
+        sequence++;
+
+        nested.SetCount(0);
+        AppendVarintField(nested, ThreadProcessField, ProcessId);
+        AppendVarintField(nested, ThreadIdField, buffer->thread);
+
+        message.SetCount(0);
+        AppendVarintField(message, TrackUUIDField, track);
+        AppendMessageField(message, TrackThreadField, nested);
+
+        packet.SetCount(0);
+        AppendVarintField(packet, SequenceField, sequence);
+        AppendMessageField(packet, TrackDescriptorField, message);
+
+        AppendMessageField(output, TracePacketField, packet);
+
+        // counter series get tracks of their own, below the thread's, which have to be described before their first value
+        counters.SetCount(0);
+        for (size_t i = 0; i < count; i++) {
+            const Event& event = buffer->events[i];
+            if ((event.ticks & CounterFlag) == 0) {
+                continue;
+            }
+
+            const CounterEntry* entry = (const CounterEntry*)(buffer->events + ++i);
+
+            bool known = false;
+            for (const CounterTrack& counter : counters) {
+                if (strcmp(counter.name, event.name) == 0 && strcmp(counter.key, entry->key) == 0) {
+                    known = true;
+                    break;
+                }
+            }
+
+            if (known) {
+                continue;
+            }
+
+            counters.Append({ .name = event.name, .key = entry->key, .uuid = ++lastUUID });
+
+            const size_t nameLength = strlen(event.name);
+            const size_t keyLength = strlen(entry->key);
+
+            nested.SetCount(0);
+            AppendBytes(nested, event.name, nameLength);
+            AppendBytes(nested, " ", 1);
+            AppendBytes(nested, entry->key, keyLength);
+
+            message.SetCount(0);
+            AppendVarintField(message, TrackUUIDField, lastUUID);
+            AppendMessageField(message, TrackNameField, nested);
+            AppendVarintField(message, TrackParentField, track);
+            AppendLengthField(message, TrackCounterField, nullptr, 0);
+
+            packet.SetCount(0);
+            AppendVarintField(packet, SequenceField, sequence);
+            AppendMessageField(packet, TrackDescriptorField, message);
+
+            AppendMessageField(output, TracePacketField, packet);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const Event& event = buffer->events[i];
+
+            const uint64_t ticks = event.ticks & ~CounterFlag;
+            const uint64_t nanoseconds = ticks > this->startTicks ? calibration.ToNanoseconds(ticks - this->startTicks) : 0;
+
+            message.SetCount(0);
+
+            if ((event.ticks & CounterFlag) != 0) {
+                const CounterEntry* entry = (const CounterEntry*)(buffer->events + ++i);
+
+                uint64_t uuid = 0;
+                for (const CounterTrack& counter : counters) {
+                    if (strcmp(counter.name, event.name) == 0 && strcmp(counter.key, entry->key) == 0) {
+                        uuid = counter.uuid;
+                        break;
+                    }
+                }
+
+                AppendVarintField(message, EventTypeField, CounterValue);
+                AppendVarintField(message, EventTrackField, uuid);
+                AppendDoubleField(message, EventDoubleValueField, entry->value);
+            } else {
+                AppendVarintField(message, EventTypeField, event.name != nullptr ? SliceBegin : SliceEnd);
+                AppendVarintField(message, EventTrackField, track);
+
+                if (event.name != nullptr) {
+                    AppendLengthField(message, EventNameField, event.name, strlen(event.name));
+                }
+            }
+
+            packet.SetCount(0);
+            AppendVarintField(packet, TimestampField, nanoseconds);
+            AppendVarintField(packet, SequenceField, sequence);
+            AppendMessageField(packet, TrackEventField, message);
+
+            AppendMessageField(output, TracePacketField, packet);
+        }
+    }
+}
+
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/RWLock.hh>
+
+namespace Cell::System {
+
+// Number of times a contended lock is retried before sleeping.
+constexpr uint32_t RWLockSpinCount = 100;
+
+void RWLock::LockSharedContended() {
+    uint32_t spins = 0;
+
+    while (true) {
+        uint32_t state = __atomic_load_n(&this->state, __ATOMIC_RELAXED);
+        if ((state & (Writing | WriterWaiting)) == 0) {
+            if (__atomic_compare_exchange_n(&this->state, &state, state + 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                return;
+            }
+
+            continue;
+        }
+
+        if (spins++ < RWLockSpinCount) {
+            CpuRelax();
+            continue;
+        }
+
+        __atomic_add_fetch(&this->waiters, 1, __ATOMIC_SEQ_CST);
+        FutexWait(&this->state, state);
+        __atomic_sub_fetch(&this->waiters, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void RWLock::LockContended() {
+    uint32_t spins = 0;
+
+    while (true) {
+        uint32_t state = __atomic_load_n(&this->state, __ATOMIC_RELAXED);
+        if ((state & (Writing | ReaderMask)) == 0) {
+            // this clears the waiting bit; other waiting writers set it again once they're woken up by the unlock
+            if (__atomic_compare_exchange_n(&this->state, &state, Writing, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                return;
+            }
+
+            continue;
+        }
+
+        if (spins++ < RWLockSpinCount) {
+            CpuRelax();
+            continue;
+        }
+
+        // keep new readers out while waiting
+        if ((state & WriterWaiting) == 0) {
+            if (!__atomic_compare_exchange_n(&this->state, &state, state | WriterWaiting, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                continue;
+            }
+
+            state |= WriterWaiting;
+        }
+
+        __atomic_add_fetch(&this->waiters, 1, __ATOMIC_SEQ_CST);
+        FutexWait(&this->state, state);
+        __atomic_sub_fetch(&this->waiters, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void RWLock::WakeWaiters() {
+    FutexWakeAll(&this->state);
+}
+
+}
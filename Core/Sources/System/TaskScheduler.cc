@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/TaskScheduler.hh>
+#include <Cell/System/Timer.hh>
+
+namespace Cell::System {
+
+TaskScheduler::TaskScheduler(JobSystem& jobs) : jobs(jobs) {
+    this->poller = new Thread(CELL_THREAD_CLASS_FUNC(TaskScheduler, RunPoller), "Cell Task Poll");
+}
+
+TaskScheduler::~TaskScheduler() {
+    __atomic_store_n(&this->running, false, __ATOMIC_SEQ_CST);
+    this->wake.Signal();
+
+    this->poller->Join();
+    delete this->poller;
+}
+
+TaskAwaiter TaskScheduler::Schedule() {
+    return TaskAwaiter(this, nullptr, nullptr, 0);
+}
+
+TaskAwaiter TaskScheduler::Delay(const uint64_t microseconds) {
+    return TaskAwaiter(this, nullptr, nullptr, GetPreciseTickerValue() + microseconds);
+}
+
+TaskAwaiter TaskScheduler::WaitFor(Event& event) {
+    return TaskAwaiter(this, [](void* parameter) {
+        return ((Event*)parameter)->IsSignaled();
+    }, &event, 0);
+}
+
+TaskAwaiter TaskScheduler::WaitUntil(TaskPollFunction poll, void* parameter) {
+    return TaskAwaiter(this, poll, parameter, 0);
+}
+
+void TaskScheduler::Enqueue(TaskAwaiter* awaiter) {
+    TaskAwaiter* head = __atomic_load_n(&this->incoming, __ATOMIC_RELAXED);
+    do {
+        awaiter->next = head;
+    } while (!__atomic_compare_exchange_n(&this->incoming, &head, awaiter, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+
+    this->wake.Signal();
+}
+
+void TaskScheduler::RunPoller() {
+    // owned by this thread alone; awaiters are removed the moment their coroutine is queued, as it may destroy them right away
+    TaskAwaiter* waiting = nullptr;
+
+    while (__atomic_load_n(&this->running, __ATOMIC_SEQ_CST)) {
+        TaskAwaiter* added = __atomic_exchange_n(&this->incoming, nullptr, __ATOMIC_ACQUIRE);
+        while (added != nullptr) {
+            TaskAwaiter* next = added->next;
+
+            added->next = waiting;
+            waiting = added;
+
+            added = next;
+        }
+
+        if (waiting == nullptr) {
+            // same as the workers; either the new awaiter is seen here, or its signal comes after the reset
+            this->wake.Reset();
+            if (__atomic_load_n(&this->incoming, __ATOMIC_SEQ_CST) == nullptr && __atomic_load_n(&this->running, __ATOMIC_SEQ_CST)) {
+                this->wake.Wait();
+            }
+
+            continue;
+        }
+
+        const uint64_t now = GetPreciseTickerValue();
+
+        TaskAwaiter** link = &waiting;
+        while (*link != nullptr) {
+            TaskAwaiter* awaiter = *link;
+            if (!awaiter->IsReady(now)) {
+                link = &awaiter->next;
+                continue;
+            }
+
+            *link = awaiter->next;
+            this->jobs.Run(TaskDetails::ResumeJob, awaiter->handle.address());
+        }
+
+        if (waiting != nullptr) {
+            Sleep(1);
+        }
+    }
+
+    CELL_ASSERT(waiting == nullptr);
+}
+
+bool TaskAwaiter::await_ready() {
+    // only scheduling always suspends; anything else might already be ready
+    if (this->poll == nullptr && this->deadline == 0) {
+        return false;
+    }
+
+    return this->IsReady(GetPreciseTickerValue());
+}
+
+void TaskAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    this->handle = handle;
+
+    if (this->poll == nullptr && this->deadline == 0) {
+        this->scheduler->jobs.Run(TaskDetails::ResumeJob, handle.address());
+        return;
+    }
+
+    this->scheduler->Enqueue(this);
+}
+
+bool TaskAwaiter::IsReady(const uint64_t now) const {
+    if (this->deadline != 0 && now >= this->deadline) {
+        return true;
+    }
+
+    return this->poll != nullptr && this->poll(this->parameter);
+}
+
+}
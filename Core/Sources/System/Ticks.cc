@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/System/Futex.hh>
+#include <Cell/System/Ticks.hh>
+#include <Cell/System/Timer.hh>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace Cell::System {
+
+// Time the counter is measured against the monotonic clock for, in nanoseconds.
+constexpr uint64_t CalibrationPeriod = 10000000;
+
+enum CalibrationState : uint32_t {
+    Uncalibrated,
+    Calibrating,
+    Calibrated
+};
+
+static TickCalibration calibration = { };
+static uint32_t calibrationState = Uncalibrated;
+
+CELL_FUNCTION_INTERNAL uint64_t ReadCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value = 0;
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(value) :: "memory");
+    return value;
+#else
+    return GetPreciseTickerNanoseconds();
+#endif
+}
+
+// Checks whether the counter runs at a constant rate, regardless of power states, and reports its frequency if the processor does.
+CELL_FUNCTION_INTERNAL bool QueryCounter(uint64_t& frequency) {
+    frequency = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+    // the invariant TSC flag is in the advanced power management leaf; hypervisors that can't keep it stable don't report it
+    uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) {
+        return false;
+    }
+
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1 << 8)) != 0;
+#elif defined(__aarch64__)
+    // the generic timer always runs at a constant rate, given by the firmware, which is occasionally wrong
+    uint64_t value = 0;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(value));
+
+    frequency = value;
+    return true;
+#else
+    return false;
+#endif
+}
+
+CELL_FUNCTION_INTERNAL void Calibrate() {
+    uint64_t frequency = 0;
+    const bool hardware = QueryCounter(frequency);
+
+    if (!hardware) {
+        frequency = 1000000000;
+    } else if (frequency == 0) {
+        // measure the counter against the clock, taking the counter halfway between two clock reads to cut out their cost
+        uint64_t clockStart = GetPreciseTickerNanoseconds();
+        uint64_t counterStart = ReadCounter();
+        clockStart = (clockStart + GetPreciseTickerNanoseconds()) / 2;
+
+        uint64_t clockEnd = 0;
+        uint64_t counterEnd = 0;
+        do {
+            clockEnd = GetPreciseTickerNanoseconds();
+            counterEnd = ReadCounter();
+            clockEnd = (clockEnd + GetPreciseTickerNanoseconds()) / 2;
+        } while (clockEnd - clockStart < CalibrationPeriod);
+
+        frequency = (uint64_t)((unsigned __int128)(counterEnd - counterStart) * 1000000000 / (clockEnd - clockStart));
+    }
+
+    calibration.frequency = frequency;
+    calibration.nanosecondScale = (uint64_t)(((unsigned __int128)1000000000 << 32) / frequency);
+    calibration.hardware = hardware;
+}
+
+CELL_FUNCTION_INTERNAL void EnsureCalibrated() {
+    uint32_t state = __atomic_load_n(&calibrationState, __ATOMIC_ACQUIRE);
+    if (state == Calibrated) {
+        return;
+    }
+
+    if (state == Uncalibrated && __atomic_compare_exchange_n(&calibrationState, &state, Calibrating, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+        Calibrate();
+
+        __atomic_store_n(&calibrationState, Calibrated, __ATOMIC_RELEASE);
+        return;
+    }
+
+    // another thread is calibrating; this only ever happens once
+    while (__atomic_load_n(&calibrationState, __ATOMIC_ACQUIRE) != Calibrated) {
+        CpuRelax();
+    }
+}
+
+uint64_t GetTicks() {
+    if (__builtin_expect(__atomic_load_n(&calibrationState, __ATOMIC_ACQUIRE) != Calibrated, 0)) {
+        EnsureCalibrated();
+    }
+
+    if (!calibration.hardware) {
+        return GetPreciseTickerNanoseconds();
+    }
+
+    return ReadCounter();
+}
+
+const TickCalibration& GetTickCalibration() {
+    EnsureCalibrated();
+    return calibration;
+}
+
+uint64_t TickCalibration::FromNanoseconds(const uint64_t nanoseconds) const {
+    return (uint64_t)((unsigned __int128)nanoseconds * this->frequency / 1000000000);
+}
+
+uint64_t TickCalibration::FromMicroseconds(const uint64_t microseconds) const {
+    return (uint64_t)((unsigned __int128)microseconds * this->frequency / 1000000);
+}
+
+}
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Collection/HashMap.hh>
+#include <Cell/System/Topology.hh>
+#include <Cell/Utilities/Move.hh>
+
+namespace Cell::System {
+
+CELL_FUNCTION_INTERNAL uint32_t Renumber(Collection::HashMap<uint64_t, uint32_t>& numbers, const uint64_t key) {
+    const uint32_t* found = numbers.Find(key);
+    if (found != nullptr) {
+        return *found;
+    }
+
+    const uint32_t number = (uint32_t)numbers.GetCount();
+    numbers.Set(key, number);
+
+    return number;
+}
+
+ProcessorTopology::ProcessorTopology(Collection::List<LogicalProcessor>& processors) : processors(Utilities::Move(processors)) {
+    Collection::HashMap<uint64_t, uint32_t> cores;
+    Collection::HashMap<uint64_t, uint32_t> cacheGroups;
+    Collection::HashMap<uint64_t, uint32_t> packages;
+
+    // core and cache numbers are only unique within a package on some platforms
+    for (LogicalProcessor& processor : this->processors) {
+        const uint64_t package = processor.package;
+
+        processor.core = Renumber(cores, package << 32 | processor.core);
+        processor.cacheGroup = Renumber(cacheGroups, package << 32 | processor.cacheGroup);
+        processor.package = Renumber(packages, package);
+    }
+
+    this->coreCount = (uint32_t)cores.GetCount();
+    this->cacheGroupCount = (uint32_t)cacheGroups.GetCount();
+}
+
+uint64_t ProcessorTopology::GetCoreMask(const uint32_t core) const {
+    uint64_t mask = 0;
+    for (const LogicalProcessor& processor : this->processors) {
+        if (processor.core == core) {
+            mask |= 1ull << processor.index;
+        }
+    }
+
+    return mask;
+}
+
+uint64_t ProcessorTopology::GetCacheGroupMask(const uint32_t cacheGroup) const {
+    uint64_t mask = 0;
+    for (const LogicalProcessor& processor : this->processors) {
+        if (processor.cacheGroup == cacheGroup) {
+            mask |= 1ull << processor.index;
+        }
+    }
+
+    return mask;
+}
+
+uint64_t ProcessorTopology::GetPrimaryMask() const {
+    uint64_t mask = 0;
+    uint64_t seenCores = 0;
+
+    // there are at most 64 processors, so there can't be more cores
+    for (const LogicalProcessor& processor : this->processors) {
+        if ((seenCores & (1ull << processor.core)) != 0) {
+            continue;
+        }
+
+        seenCores |= 1ull << processor.core;
+        mask |= 1ull << processor.index;
+    }
+
+    return mask;
+}
+
+}
@@ -1,12 +1,112 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Collection/HashMap.hh>
+#include <Cell/Collection/InlineList.hh>
 #include <Cell/Collection/List.hh>
+#include <Cell/Collection/MPMCQueue.hh>
+#include <Cell/Collection/RingBuffer.hh>
+#include <Cell/Collection/Single.hh>
+#include <Cell/Collection/Span.hh>
+#include <Cell/Collection/VirtualList.hh>
+#include <Cell/Collection/WorkStealingDeque.hh>
 #include <Cell/System/Entry.hh>
+#include <Cell/System/Thread.hh>
 
 using namespace Cell;
 using namespace Cell::Collection;
 
+CELL_STATIC_ASSERT(Enumerable<List<uint32_t>> && Enumerable<HashMap<uint32_t, uint32_t>> && Enumerable<Span<const uint32_t>>);
+CELL_STATIC_ASSERT(ContiguousEnumerable<const List<uint32_t>, const uint32_t> && !ContiguousEnumerable<const List<uint32_t>, uint32_t>);
+
+static uint64_t Sum(const Span<const uint32_t> values) {
+    uint64_t sum = 0;
+    for (uint32_t value : values) {
+        sum += value;
+    }
+
+    return sum;
+}
+
+constexpr uint32_t StreamedCount = 1000000;
+
+static void ProduceNumbers(void* parameter) {
+    RingBuffer<uint32_t>* ring = (RingBuffer<uint32_t>*)parameter;
+
+    uint32_t next = 0;
+    while (next < StreamedCount) {
+        // alternate between copying and writing in place
+        if (next % 2 == 0) {
+            uint32_t batch[7];
+            for (uint32_t i = 0; i < 7; i++) {
+                batch[i] = next + i;
+            }
+
+            next += (uint32_t)ring->PushMany(batch, next + 7 <= StreamedCount ? 7 : StreamedCount - next);
+            continue;
+        }
+
+        Span<uint32_t> region = ring->BeginWrite(StreamedCount - next);
+        for (uint32_t& element : region) {
+            element = next++;
+        }
+
+        ring->CommitWrite(region.GetCount());
+    }
+}
+
+constexpr uint64_t QueuedPerThread = 100000;
+
+struct QueueTest {
+    MPMCQueue<uint64_t>* queue;
+    uint64_t sum;
+    uint64_t count;
+};
+
+static void FillQueue(void* parameter) {
+    QueueTest* test = (QueueTest*)parameter;
+
+    for (uint64_t i = 1; i <= QueuedPerThread; i++) {
+        while (!test->queue->Push(i)) {
+            System::Thread::Yield();
+        }
+    }
+}
+
+static void DrainQueue(void* parameter) {
+    QueueTest* test = (QueueTest*)parameter;
+
+    while (test->count < QueuedPerThread) {
+        uint64_t value = 0;
+        if (!test->queue->Pop(value)) {
+            System::Thread::Yield();
+            continue;
+        }
+
+        test->sum += value;
+        test->count++;
+    }
+}
+
+struct StealTest {
+    WorkStealingDeque<uint64_t>* deque;
+    uint64_t sum;
+    uint64_t count;
+    bool* done;
+};
+
+static void StealFromDeque(void* parameter) {
+    StealTest* test = (StealTest*)parameter;
+
+    while (!__atomic_load_n(test->done, __ATOMIC_ACQUIRE) || !test->deque->IsEmpty()) {
+        uint64_t value = 0;
+        if (test->deque->Steal(value)) {
+            test->sum += value;
+            test->count++;
+        }
+    }
+}
+
 void CellEntry(Reference<String> parameterString) {
     (void)(parameterString);
 
@@ -16,4 +116,222 @@ void CellEntry(Reference<String> parameterString) {
     data.Remove(data.GetCount() - 2);
 
     CELL_ASSERT(data[0] == 15 && data[1] == 25 && data.GetCount() == 2);
+
+    List<uint32_t> numbers;
+    numbers.Reserve(100);
+    CELL_ASSERT(numbers.GetCapacity() == 100 && numbers.GetCount() == 0);
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        numbers.Append(i);
+    }
+
+    CELL_ASSERT(numbers.GetCount() == 1000 && numbers.GetCapacity() >= 1000 && numbers[999] == 999);
+
+    CELL_ASSERT(Sum(numbers) == 999 * 1000 / 2 && Sum(Span<const uint32_t>(numbers).Slice(10, 2)) == 21);
+
+    const uint32_t single = 7;
+    CELL_ASSERT(Sum(Single(single)) == 7);
+
+    numbers.Remove((size_t)0);
+    CELL_ASSERT(numbers[0] == 1 && numbers[998] == 999 && numbers.GetCount() == 999);
+
+    numbers.ShrinkToFit();
+    CELL_ASSERT(numbers.GetCapacity() == 999);
+
+    List<uint32_t> moved = Utilities::Move(numbers);
+    CELL_ASSERT(moved.GetCount() == 999 && numbers.GetCount() == 0);
+
+    List<String> strings;
+    strings.Append(String("first"));
+    strings.Emplace("second");
+
+    for (size_t i = 0; i < 20; i++) {
+        strings.Append(strings[0]);
+    }
+
+    strings.Remove((size_t)0);
+    CELL_ASSERT(strings[0] == "second" && strings[1] == "first" && strings.GetCount() == 21);
+
+    List<String> copy = strings;
+    strings.Reset();
+    CELL_ASSERT(copy.GetCount() == 21 && copy[20] == "first");
+
+    copy.SetCount(30);
+    CELL_ASSERT(copy[29].IsEmpty());
+
+    InlineList<String, 4> small;
+    small.Append(String("a"));
+    small.Emplace("b");
+    CELL_ASSERT(small.IsInline() && small.GetCount() == 2 && small[1] == "b");
+
+    for (size_t i = 0; i < 6; i++) {
+        small.Append(small[0]);
+    }
+
+    CELL_ASSERT(!small.IsInline() && small.GetCount() == 8 && small[7] == "a");
+
+    InlineList<String, 4> smallMoved = Utilities::Move(small);
+    CELL_ASSERT(small.IsInline() && small.GetCount() == 0 && smallMoved.GetCount() == 8);
+
+    InlineList<uint32_t, 8> inlineNumbers = { 1, 2, 3 };
+    InlineList<uint32_t, 8> inlineCopy = Utilities::Move(inlineNumbers);
+    inlineCopy.Remove((size_t)0);
+
+    CELL_ASSERT(inlineCopy.IsInline() && inlineCopy[0] == 2 && inlineCopy.GetCount() == 2 && inlineNumbers.GetCount() == 0);
+
+    VirtualList<uint64_t> large(1ull << 30);
+    for (uint64_t i = 0; i < 100000; i++) {
+        large.Append(i);
+    }
+
+    uint64_t* first = large.GetPointer(0);
+    large.Append(100000);
+
+    CELL_ASSERT(large.GetPointer(0) == first && large[99999] == 99999 && large.GetCount() == 100001);
+
+    large.Remove(0);
+    CELL_ASSERT(large[0] == 1 && large.GetCount() == 100000);
+
+    large.Reset();
+    CELL_ASSERT(large.GetCommittedSize() == 0);
+
+    large.SetCount(10);
+    CELL_ASSERT(large[9] == 0);
+
+    // elements that own memory are constructed, moved and destructed properly
+    VirtualList<String> labels(1024);
+    for (size_t i = 0; i < 100; i++) {
+        labels.Append(String::Format("a name long enough to need the heap, %", i));
+    }
+
+    labels.Remove(0);
+    labels.SetCount(50);
+    CELL_ASSERT(labels.GetCount() == 50 && labels[0] == "a name long enough to need the heap, 1");
+
+    labels.SetCount(60);
+    CELL_ASSERT(labels[59].IsEmpty() && labels[49] == "a name long enough to need the heap, 50");
+
+    HashMap<uint32_t, uint32_t> squares;
+    for (uint32_t i = 0; i < 10000; i++) {
+        squares.Set(i, i * i);
+    }
+
+    CELL_ASSERT(squares.GetCount() == 10000 && squares.GetValue(100) == 10000 && squares.Find(10000) == nullptr);
+
+    for (uint32_t i = 0; i < 10000; i += 2) {
+        const bool removed = squares.Remove(i);
+        CELL_ASSERT(removed);
+    }
+
+    const bool removedAgain = squares.Remove(0);
+    CELL_ASSERT(squares.GetCount() == 5000 && !removedAgain && !squares.Has(4).IsValid());
+
+    uint64_t sum = 0;
+    for (uint32_t value : squares) {
+        sum += value;
+    }
+
+    for (uint32_t i = 1; i < 10000; i += 2) {
+        CELL_ASSERT(squares.GetValue(i) == i * i);
+        sum -= i * i;
+    }
+
+    CELL_ASSERT(sum == 0);
+
+    squares.Rehash(0);
+    CELL_ASSERT(squares.GetCapacity() >= 5000 && squares.GetValue(9999) == 9999 * 9999);
+
+    HashMap<String, uint32_t> names(4);
+    names.Set("first", 1);
+    names.Set("second", 2);
+    names.GetOrAdd("third") = 3;
+    names.Set("first", 4);
+
+    CELL_ASSERT(names.GetCount() == 3 && names.GetValue("first") == 4 && names.GetKey(2) == "third");
+
+    HashMap<String, uint32_t> namesCopy = names;
+    const bool removedName = names.Remove("first");
+
+    CELL_ASSERT(removedName && names.GetCount() == 2 && names.GetKey(0) == "third" && namesCopy.GetValue("first") == 4);
+
+    RingBuffer<uint32_t> ring(1000);
+    CELL_ASSERT(ring.GetCapacity() == 1024 && ring.IsEmpty());
+
+    System::Thread producer(ProduceNumbers, &ring);
+
+    uint32_t expected = 0;
+    while (expected < StreamedCount) {
+        uint32_t element = 0;
+        if (expected % 3 == 0 && ring.Pop(element)) {
+            CELL_ASSERT(element == expected);
+
+            expected++;
+            continue;
+        }
+
+        Span<const uint32_t> region = ring.BeginRead(64);
+        for (uint32_t value : region) {
+            CELL_ASSERT(value == expected);
+            expected++;
+        }
+
+        ring.CommitRead(region.GetCount());
+    }
+
+    producer.Join();
+    CELL_ASSERT(ring.IsEmpty());
+
+    MPMCQueue<uint64_t> queue(64);
+    QueueTest producers[3] = { { &queue, 0, 0 }, { &queue, 0, 0 }, { &queue, 0, 0 } };
+    QueueTest consumers[3] = { { &queue, 0, 0 }, { &queue, 0, 0 }, { &queue, 0, 0 } };
+
+    {
+        System::Thread producerThreads[3] = { System::Thread(FillQueue, producers), System::Thread(FillQueue, producers + 1), System::Thread(FillQueue, producers + 2) };
+        System::Thread consumerThreads[3] = { System::Thread(DrainQueue, consumers), System::Thread(DrainQueue, consumers + 1), System::Thread(DrainQueue, consumers + 2) };
+
+        for (size_t i = 0; i < 3; i++) {
+            producerThreads[i].Join();
+            consumerThreads[i].Join();
+        }
+    }
+
+    const uint64_t queuedSum = QueuedPerThread * (QueuedPerThread + 1) / 2 * 3;
+    CELL_ASSERT(consumers[0].sum + consumers[1].sum + consumers[2].sum == queuedSum && queue.GetCount() == 0);
+
+    WorkStealingDeque<uint64_t> deque(16);
+    bool done = false;
+    StealTest thieves[2] = { { &deque, 0, 0, &done }, { &deque, 0, 0, &done } };
+
+    uint64_t ownSum = 0;
+    uint64_t ownCount = 0;
+
+    {
+        System::Thread thiefThreads[2] = { System::Thread(StealFromDeque, thieves), System::Thread(StealFromDeque, thieves + 1) };
+
+        for (uint64_t i = 1; i <= QueuedPerThread; i++) {
+            deque.Push(i);
+
+            uint64_t value = 0;
+            if (i % 3 == 0 && deque.Pop(value)) {
+                ownSum += value;
+                ownCount++;
+            }
+        }
+
+        uint64_t value = 0;
+        while (!deque.IsEmpty()) {
+            if (deque.Pop(value)) {
+                ownSum += value;
+                ownCount++;
+            }
+        }
+
+        __atomic_store_n(&done, true, __ATOMIC_RELEASE);
+
+        thiefThreads[0].Join();
+        thiefThreads[1].Join();
+    }
+
+    CELL_ASSERT(ownCount + thieves[0].count + thieves[1].count == QueuedPerThread);
+    CELL_ASSERT(ownSum + thieves[0].sum + thieves[1].sum == QueuedPerThread * (QueuedPerThread + 1) / 2);
 }
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Collection/List.hh>
+#include <Cell/Memory/Arena.hh>
+#include <Cell/Memory/OwnedBlock.hh>
+#include <Cell/Memory/Slab.hh>
+#include <Cell/Memory/Tracking.hh>
+#include <Cell/System/Entry.hh>
+#include <Cell/System/Thread.hh>
+#include <Cell/Utilities/Preprocessor.hh>
+
+using namespace Cell;
+using namespace Cell::Memory;
+
+void CellEntry(Reference<String> parameterString) {
+    (void)(parameterString);
+
+    Arena arena(256);
+
+    uint64_t* numbers = arena.AllocateZeroed<uint64_t>(4);
+    CELL_ASSERT(((uintptr_t)numbers % 16) == 0 && numbers[0] == 0 && numbers[3] == 0);
+
+    // blocks keep their alignment when they have to move to grow
+    void* wide = arena.Allocate(16, 128);
+    (void)(arena.Allocate(16));
+    arena.Reallocate(wide, 16, 64, 128);
+    CELL_ASSERT(((uintptr_t)wide % 128) == 0);
+
+    const Arena::Checkpoint checkpoint = arena.GetCheckpoint();
+    {
+        ScopedCheckpoint scope(arena);
+
+        Collection::List<uint32_t> list(arena);
+        for (uint32_t i = 0; i < 200; i++) {
+            list.Append(i);
+        }
+
+        CELL_ASSERT(list.GetCount() == 200 && list[0] == 0 && list[199] == 199);
+
+        String string(arena, "Hello");
+        string += " World";
+        CELL_ASSERT(string == "Hello World");
+
+        OwnedBlock<uint8_t> block(arena, 1024);
+        CELL_ASSERT(block.GetSize() == 1024);
+    }
+
+    CELL_ASSERT(arena.GetCheckpoint().chunk == checkpoint.chunk && arena.GetCheckpoint().offset == checkpoint.offset);
+
+    arena.Reset();
+    CELL_ASSERT(arena.AllocateZeroed<uint64_t>(4) == numbers);
+
+    FrameArena frames(128);
+    uint8_t* previous = frames.Get().Allocate<uint8_t>(16);
+    frames.Flip();
+    frames.Flip();
+    CELL_ASSERT(frames.Get().Allocate<uint8_t>(16) == previous);
+
+    uint8_t* blocks[200] = { nullptr };
+    for (size_t i = 0; i < CELL_COUNT_OF(blocks); i++) {
+        blocks[i] = (uint8_t*)SlabAllocate(24);
+        CELL_ASSERT(((uintptr_t)blocks[i] % 16) == 0 && blocks[i][0] == 0 && blocks[i][23] == 0);
+
+        Memory::Clear(blocks[i], 24);
+        blocks[i][0] = 0xff;
+    }
+
+    for (size_t i = 0; i < CELL_COUNT_OF(blocks); i++) {
+        SlabFree(blocks[i], 24);
+    }
+
+    uint8_t* reused = (uint8_t*)SlabAllocate(20);
+    CELL_ASSERT(reused == blocks[CELL_COUNT_OF(blocks) - 1] && reused[0] == 0);
+    SlabFree(reused, 20);
+
+    String* string = new String("Slab");
+    CELL_ASSERT(*string == "Slab");
+    delete string;
+
+    // over-aligned objects bypass the slabs
+    struct alignas(128) CacheLines : public Object {
+        uint64_t values[4];
+    };
+
+    CacheLines* lines = new CacheLines();
+    CELL_ASSERT(((uintptr_t)lines % 128) == 0 && lines->values[3] == 0);
+    delete lines;
+
+    // blocks cached by a thread are handed over once it exits
+    static void* released = nullptr;
+    System::Thread exiting([](void* parameter) {
+        (void)(parameter);
+
+        released = SlabAllocate(SlabMaximumSize);
+        SlabFree(released, SlabMaximumSize);
+    });
+
+    exiting.Join();
+
+    void* inherited = SlabAllocate(SlabMaximumSize);
+    CELL_ASSERT(inherited == released);
+    SlabFree(inherited, SlabMaximumSize);
+
+    uint32_t* aligned = AllocateAligned<uint32_t>(16, 64);
+    CELL_ASSERT(((uintptr_t)aligned % 64) == 0);
+
+    for (uint32_t i = 0; i < 16; i++) {
+        aligned[i] = i;
+    }
+
+    ReallocateAligned<uint32_t>(aligned, 16, 4096, 64);
+    CELL_ASSERT(((uintptr_t)aligned % 64) == 0 && aligned[15] == 15);
+    FreeAligned(aligned);
+
+    OwnedBlock<uint8_t> uninitialized(256, Uninitialized);
+    CELL_ASSERT(uninitialized.GetSize() == 256);
+
+#ifdef CELL_CORE_MEMORY_TRACKING
+    {
+        CELL_MEMORY_TAG(Audio);
+
+        void* tracked = Allocate(1000);
+        SampleTracking();
+        CELL_ASSERT(GetTagStatistics(Tag::Audio).liveBytes == 1000 && GetTagStatistics(Tag::Audio).liveBlocks == 1);
+
+        Free(tracked);
+
+        // the peak is caught even if it's never sampled
+        void* peak = Allocate(3000);
+        Free(peak);
+
+        // reallocating resizes the block, rather than counting another one
+        void* grown = Allocate(100);
+        Reallocate(grown, 200);
+        SampleTracking();
+        CELL_ASSERT(GetTagStatistics(Tag::Audio).liveBytes == 200 && GetTagStatistics(Tag::Audio).liveBlocks == 1 && GetTagStatistics(Tag::Audio).allocations == 3);
+
+        Free(grown);
+    }
+
+    SampleTracking();
+    CELL_ASSERT(GetTagStatistics(Tag::Audio).liveBytes == 0 && GetTagStatistics(Tag::Audio).peakBytes == 3000);
+#endif
+}
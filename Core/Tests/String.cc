@@ -1,8 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Atom.hh>
+#include <Cell/Collection/HashMap.hh>
 #include <Cell/System/Entry.hh>
 #include <Cell/System/Log.hh>
+#include <Cell/System/Thread.hh>
+#include <Cell/Utilities/Move.hh>
 
 using namespace Cell;
 
@@ -18,6 +22,121 @@ void CellEntry(Reference<String> parameterString) {
     CELL_ASSERT(b == " World");
     CELL_ASSERT(c == "Hello World");
 
+    // short strings stay inline, longer ones grow geometrically
+    String inlined = "short enough to be inline";
+    CELL_ASSERT(inlined.GetSize() == 25 && inlined.GetCapacity() >= 25);
+
+    String grown;
+    CELL_ASSERT(grown.GetCapacity() == StringDetails::InlineCapacity);
+
+    for (size_t i = 0; i < 100; i++) {
+        grown += "x";
+    }
+
+    CELL_ASSERT(grown.GetSize() == 100 && grown.GetCapacity() >= 100 && grown.GetCapacity() < 200);
+
+    grown += grown;
+    CELL_ASSERT(grown.GetSize() == 200 && grown.BeginsWith("xxxxxxxxxx") && grown.EndsWith("xxxxxxxxxx"));
+
+    grown.Clear();
+    CELL_ASSERT(grown.IsEmpty() && grown.GetCapacity() >= 200);
+
+    String reserved;
+    reserved.Reserve(64);
+    CELL_ASSERT(reserved.GetCapacity() == 64 && reserved.IsEmpty());
+
+    // moves take over heap storage, and leave the original empty
+    String longer = "a string that definitely does not fit inline";
+    const char* longerData = longer.ToRawPointer();
+
+    String moved = Utilities::Move(longer);
+    CELL_ASSERT(moved.ToRawPointer() == longerData && longer.IsEmpty());
+    CELL_ASSERT(moved == "a string that definitely does not fit inline");
+
+    String shortMoved = Utilities::Move(a);
+    CELL_ASSERT(shortMoved == "Hello" && a.IsEmpty());
+
+    a = Utilities::Move(moved);
+    CELL_ASSERT(a.ToRawPointer() == longerData && moved.IsEmpty());
+
+    CELL_ASSERT(c.Substring(6, 5).Unwrap() == "World");
+    const char* two = "two";
+    CELL_ASSERT(String::Format("literal % text % longer than the inline storage", 1, two) == "literal 1 text two longer than the inline storage");
+
+    // numbers are written in full, and floating point ones as short as they can be while reading back the same
+    CELL_ASSERT(String::Format("% % %", (int64_t)INT64_MIN, (uint64_t)UINT64_MAX, 0) == "-9223372036854775808 18446744073709551615 0");
+    CELL_ASSERT(String::Format("% % % %", 0.1, -1.5, 3.0, 1e-9) == "0.1 -1.5 3 1e-9");
+    CELL_ASSERT(String::Format("% %", 123456.789, 1e300) == "123456.789 1e+300");
+    CELL_ASSERT(String::Format("% % % %", 0.1f, 16.7f, -2.5f, 3.4028235e38f) == "0.1 16.7 -2.5 3.4028235e+38");
+    CELL_ASSERT(String::Format("%", (const void*)0x1234) == "0x0000000000001234");
+    CELL_ASSERT(String::Format("no placeholders") == "no placeholders");
+
+    char buffer[16];
+    Wrapped<size_t, StringDetails::Result> written = String::FormatTo(buffer, sizeof(buffer), "% + % = %", 1, 2, 3);
+    CELL_ASSERT(written.IsValid() && written.Unwrap() == 9);
+    CELL_ASSERT(String(buffer, 9) == "1 + 2 = 3");
+
+    written = String::FormatTo(buffer, sizeof(buffer), "% is far too long to fit", two);
+    CELL_ASSERT(!written.IsValid() && written.Result() == StringDetails::Result::NotEnoughMemory);
+
+    // views slice without copying
+    const StringView path = "Content/Textures/Stone.png";
+    CELL_ASSERT(path.BeginsWith("Content/") && path.EndsWith(".png") && path.BeginsWith(path) && !path.EndsWith("xContent/Textures/Stone.png"));
+    CELL_ASSERT(path.Find('/') == 7 && path.FindLast('/') == 16 && path.Find("Stone") == 17 && path.Find("stone") == StringView::NotFound);
+    CELL_ASSERT(path.Substring(8, 8).Unwrap() == "Textures" && !path.Substring(20, 10).IsValid());
+
+    StringView remaining = path;
+    CELL_ASSERT(remaining.TakeToken('/') == "Content" && remaining.TakeToken('/') == "Textures" && remaining.TakeToken('/') == "Stone.png");
+    CELL_ASSERT(remaining.IsEmpty());
+
+    StringView name;
+    StringView extension;
+    CELL_ASSERT(StringView("Stone.png").Split('.', name, extension) && name == "Stone" && extension == "png");
+
+    CELL_ASSERT(StringView("  \tpadded\n").Trim() == "padded" && StringView("   ").Trim().IsEmpty());
+
+    CELL_ASSERT(StringView("18446744073709551615").AsNumber().Unwrap() == UINT64_MAX && !StringView("18446744073709551616").AsNumber().IsValid());
+    CELL_ASSERT(StringView("054C").AsNumber(true).Unwrap() == 0x54c && !StringView("12ab").AsNumber().IsValid() && !StringView("").AsNumber().IsValid());
+    CELL_ASSERT(StringView("-9223372036854775808").AsSignedNumber().Unwrap() == INT64_MIN && !StringView("-").AsSignedNumber().IsValid());
+    CELL_ASSERT(StringView("-1.5e3").AsDouble().Unwrap() == -1500.0 && !StringView("1.5x").AsDouble().IsValid() && !StringView(" 1").AsDouble().IsValid());
+    CELL_ASSERT(StringView("0.1000000000000000000000000000000000000000000000000000000000000000000000000001").AsDouble().Unwrap() == 0.1);
+
+    // strings convert to views, which they can be compared with and built from
+    const StringView world = " World";
+    CELL_ASSERT(b == world && world == b && String(world) == b && c.EndsWith(world) && c.BeginsWith(c) && c != b);
+    CELL_ASSERT(String::Format("[%]", path.Substring(17, 5).Unwrap()) == "[Stone]");
+
+    // interning text once makes equal text equal atoms, with a hash that can be known at compile time
+    constexpr uint32_t positionHash = Atom::ComputeHash("POSITION");
+    const Atom position = Atom::Intern("POSITION", positionHash);
+    CELL_ASSERT(position == Atom::Intern(String("POSITION")) && position != Atom::Intern("NORMAL") && !position.IsEmpty());
+    CELL_ASSERT(position.GetText() == "POSITION" && position.GetHash() == positionHash && Atom::Intern("").IsEmpty());
+    CELL_ASSERT(Atom::Find("POSITION").Unwrap() == position && !Atom::Find("TEXCOORD_7").IsValid());
+
+    // interning from several threads at once, while the table grows
+    auto internMany = [](void* parameter) {
+        (void)(parameter);
+
+        for (size_t i = 0; i < 5000; i++) {
+            (void)(Atom::Intern(String::Format("atom %", i)));
+        }
+    };
+
+    System::Thread interning(internMany);
+    internMany(nullptr);
+    interning.Join();
+
+    Collection::HashMap<Atom, size_t> atoms;
+    for (size_t i = 0; i < 5000; i++) {
+        const String text = String::Format("atom %", i);
+        const Atom atom = Atom::Find(text).Unwrap();
+
+        CELL_ASSERT(atom.GetText() == text && atom.GetHash() == Atom::ComputeHash(text));
+        atoms.Set(atom, i);
+    }
+
+    CELL_ASSERT(atoms.GetCount() == 5000 && atoms.GetValue(Atom::Intern("atom 42")) == 42);
+
     //String euro = "€";
 
     //CELL_ASSERT(euro.GetSize() == 3);
@@ -1,8 +1,25 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/System/ConditionVariable.hh>
 #include <Cell/System/Entry.hh>
 #include <Cell/System/Event.hh>
+#include <Cell/System/FramePacer.hh>
+#include <Cell/System/JobSystem.hh>
+#include <Cell/System/LogSinks.hh>
+#include <Cell/System/Metrics.hh>
+#include <Cell/System/Mutex.hh>
+#include <Cell/System/PerfCounters.hh>
+#include <Cell/System/Profiler.hh>
+#include <Cell/System/RWLock.hh>
+#include <Cell/System/Spinlock.hh>
+#include <Cell/System/TaskScheduler.hh>
+#include <Cell/System/Thread.hh>
+#include <Cell/System/Ticks.hh>
+#include <Cell/System/Timer.hh>
+#include <Cell/System/Topology.hh>
+
+#include <string.h>
 
 #include <Cell/Scoped.hh>
 #include <Cell/IO/File.hh>
@@ -11,6 +28,106 @@
 using namespace Cell;
 using namespace Cell::System;
 
+struct LockTest {
+    Mutex mutex;
+    RWLock rwLock;
+    Spinlock spinlock;
+    ConditionVariable condition;
+
+    uint64_t mutexCount;
+    uint64_t rwCount;
+    uint64_t spinCount;
+    uint32_t finished;
+};
+
+size_t CountOccurrences(const Collection::List<uint8_t>& data, const char* text, const size_t length) {
+    size_t count = 0;
+    for (size_t i = 0; i + length <= data.GetCount(); i++) {
+        if (Memory::Compare(data.begin() + i, (const uint8_t*)text, length)) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void ContendLocks(void* parameter) {
+    LockTest* test = (LockTest*)parameter;
+
+    for (uint32_t i = 0; i < 100000; i++) {
+        test->mutex.Lock();
+        test->mutexCount++;
+        test->mutex.Unlock();
+
+        if (i % 8 == 0) {
+            test->rwLock.Lock();
+            test->rwCount++;
+            test->rwLock.Unlock();
+        } else {
+            test->rwLock.LockShared();
+            CELL_ASSERT(test->rwCount <= 4 * 100000);
+            test->rwLock.UnlockShared();
+        }
+
+        test->spinlock.Lock();
+        test->spinCount++;
+        test->spinlock.Unlock();
+    }
+
+    test->mutex.Lock();
+    test->finished++;
+    test->condition.Signal();
+    test->mutex.Unlock();
+}
+
+struct JobTest {
+    JobSystem* jobs;
+    uint32_t counted;
+    uint32_t order[3];
+    uint32_t ordered;
+};
+
+void CountJob(void* parameter) {
+    JobTest* test = (JobTest*)parameter;
+    __atomic_add_fetch(&test->counted, 1, __ATOMIC_RELAXED);
+}
+
+void NestedJob(void* parameter) {
+    JobTest* test = (JobTest*)parameter;
+
+    // waits from within a worker, which has to keep running jobs meanwhile
+    JobCounter counter;
+    for (uint32_t i = 0; i < 16; i++) {
+        test->jobs->Run(CountJob, test, &counter);
+    }
+
+    test->jobs->Wait(counter);
+}
+
+template <uint32_t N> void OrderedJob(void* parameter) {
+    JobTest* test = (JobTest*)parameter;
+    test->order[test->ordered++] = N;
+}
+
+Task<uint32_t> Square(TaskScheduler& scheduler, const uint32_t value) {
+    co_await scheduler.Delay(100);
+
+    const uint32_t squared = co_await scheduler.Offload([value] { return value * value; });
+    co_return squared;
+}
+
+Task<uint32_t> SumOfSquares(TaskScheduler& scheduler, Event& event, const uint32_t count) {
+    co_await scheduler.Schedule();
+
+    uint32_t sum = 0;
+    for (uint32_t i = 1; i <= count; i++) {
+        sum += co_await Square(scheduler, i);
+    }
+
+    co_await scheduler.WaitFor(event);
+    co_return sum;
+}
+
 void CellEntry(Reference<String> parameterString) {
     (void)(parameterString);
 
@@ -28,4 +145,335 @@ void CellEntry(Reference<String> parameterString) {
 
     event.Reset();
     CELL_ASSERT(event.Wait(1) == Result::Timeout);
+
+    JobSystem jobs(3);
+    CELL_ASSERT(jobs.GetWorkerCount() == 3);
+
+    JobTest test = { .jobs = &jobs, .counted = 0, .order = { 0, 0, 0 }, .ordered = 0 };
+
+    JobCounter counter;
+    CELL_ASSERT(counter.IsDone());
+
+    for (uint32_t i = 0; i < 10000; i++) {
+        jobs.Run(CountJob, &test, &counter);
+    }
+
+    jobs.Wait(counter);
+    CELL_ASSERT(counter.IsDone());
+    CELL_ASSERT(test.counted == 10000);
+
+    for (uint32_t i = 0; i < 8; i++) {
+        jobs.Run(NestedJob, &test, &counter);
+    }
+
+    jobs.Wait(counter);
+    CELL_ASSERT(test.counted == 10000 + 8 * 16);
+
+    // each job depends on the previous one, so they have to run in order
+    JobCounter first;
+    JobCounter second;
+    JobCounter third;
+
+    jobs.Run(OrderedJob<1>, &test, &first);
+    jobs.RunAfter(first, OrderedJob<2>, &test, &second);
+    jobs.RunAfter(second, OrderedJob<3>, &test, &third);
+
+    jobs.Wait(third);
+    CELL_ASSERT(test.ordered == 3);
+    CELL_ASSERT(test.order[0] == 1 && test.order[1] == 2 && test.order[2] == 3);
+
+    uint64_t sums[100] = { 0 };
+    jobs.ParallelFor(100000, 1000, [&sums](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            sums[begin / 1000] += i;
+        }
+    });
+
+    uint64_t sum = 0;
+    for (const uint64_t part : sums) {
+        sum += part;
+    }
+
+    CELL_ASSERT(sum == 100000ull * 99999 / 2);
+
+    TaskScheduler scheduler(jobs);
+
+    Event ready;
+    Task<uint32_t> task = SumOfSquares(scheduler, ready, 10);
+
+    JobCounter taskCounter;
+    task.Start(jobs, &taskCounter);
+
+    jobs.Run([](void* parameter) {
+        ((Event*)parameter)->Signal();
+    }, &ready);
+
+    jobs.Wait(taskCounter);
+    CELL_ASSERT(task.IsDone());
+    CELL_ASSERT(task.GetResult() == 385);
+
+    ready.Reset();
+    ready.Signal();
+    CELL_ASSERT(SumOfSquares(scheduler, ready, 3).Wait(jobs) == 14);
+
+    ScopedObject<ProcessorTopology> topology = ProcessorTopology::Query().Unwrap();
+    CELL_ASSERT(!topology->GetProcessors().IsEmpty() && topology->GetCoreCount() > 0 && topology->GetCacheGroupCount() > 0);
+    CELL_ASSERT(topology->GetCoreMask(0) != 0 && (topology->GetPrimaryMask() & topology->GetCoreMask(0)) != 0);
+
+    Event release;
+    Thread thread([](void* parameter) {
+        ((Event*)parameter)->Wait();
+    }, &release, "Cell Test");
+
+    CELL_ASSERT(thread.IsActive());
+    // running niced or in a restricted container may forbid priorities above the current one
+    const Result lowResult = thread.SetPriority(ThreadPriority::Low);
+    CELL_ASSERT(lowResult == Result::Success || lowResult == Result::AccessDenied);
+
+    // not every platform supports hard affinity
+    const Result affinityResult = thread.SetAffinity(topology->GetCoreMask(0));
+    CELL_ASSERT(affinityResult == Result::Success || affinityResult == Result::Unsupported);
+
+    CELL_ASSERT(thread.Join(1) == Result::Timeout);
+
+    release.Signal();
+    CELL_ASSERT(thread.Join() == Result::Success);
+    CELL_ASSERT(!thread.IsActive());
+    CELL_ASSERT(thread.SetPriority(ThreadPriority::Normal) == Result::Expired);
+
+    const Result normalResult = Thread::SetCurrentPriority(ThreadPriority::Normal);
+    CELL_ASSERT(normalResult == Result::Success || normalResult == Result::AccessDenied);
+
+    // frames may start late, but never early; the interval is long enough for most of each wait to be slept
+    const uint64_t start = GetPreciseTickerValue();
+    FramePacer pacer(5000);
+
+    uint64_t woken = 0;
+    for (uint32_t i = 0; i < 20; i++) {
+        woken = pacer.Wait();
+    }
+
+    CELL_ASSERT(woken >= start + 20 * 5000 && pacer.GetSpinMargin() <= 5000 / 4);
+
+    // short intervals only spin part of each frame
+    FramePacer shortPacer(400);
+    CELL_ASSERT(shortPacer.GetSpinMargin() <= 100);
+
+    pacer.SetInterval(400);
+    CELL_ASSERT(pacer.GetSpinMargin() <= 100);
+    pacer.SetInterval(5000);
+
+    // changing the interval keeps the schedule, rather than restarting it from the time of the change
+    const uint64_t previous = pacer.Wait();
+    SleepPrecise(4000);
+    pacer.SetInterval(10000);
+
+    const uint64_t rescheduled = pacer.Wait();
+    CELL_ASSERT(rescheduled < previous + 4000 + 10000);
+
+    uint64_t waits = 0;
+    for (const uint64_t count : pacer.GetJitterHistogram()) {
+        waits += count;
+    }
+
+    CELL_ASSERT(waits == 22);
+
+    const uint64_t deadline = GetPreciseTickerValue() + 2000;
+    CELL_ASSERT(pacer.WaitUntil(deadline) >= deadline);
+
+    const TickCalibration& calibration = GetTickCalibration();
+    CELL_ASSERT(calibration.frequency > 0);
+
+    // conversions truncate, so a round trip may come up a tick or two short
+    const uint64_t roundTrip = calibration.FromNanoseconds(calibration.ToNanoseconds(1000000));
+    CELL_ASSERT(roundTrip <= 1000000 && roundTrip >= 1000000 - 2);
+
+    const uint64_t ticksStart = GetTicks();
+    SleepPrecise(2000);
+    const uint64_t ticksElapsed = TicksToMicroseconds(GetTicks() - ticksStart);
+
+    CELL_ASSERT(ticksElapsed >= 1900 && ticksElapsed < 1000000);
+
+    {
+        Logger logger(4096);
+        MemoryLogSink* memory = new MemoryLogSink(4);
+        logger.AddSink(memory);
+
+        {
+            // strings are captured right away, so they may go away before the message is written
+            String temporary = "temporary";
+            Log(LogLevel::Warning, "% and % from %", 42, -7, temporary);
+        }
+
+        Thread logging([](void* parameter) {
+            (void)(parameter);
+            Log("raw 100%");
+        });
+
+        logging.Join();
+        logger.Flush();
+
+        Collection::List<String> messages = memory->GetMessages();
+        CELL_ASSERT(messages.GetCount() == 2);
+        CELL_ASSERT(messages[0].EndsWith("Warning: 42 and -7 from temporary"));
+        CELL_ASSERT(messages[1].EndsWith("Info: raw 100%"));
+
+        // counts the messages that made it through, as the memory sink only keeps the last few
+        class CountingLogSink : public ILogSink {
+        public:
+            void Write(const LogLevel level, const uint64_t timestamp, const String& message) override {
+                (void)(timestamp); (void)(message);
+
+                if (level == LogLevel::Info) {
+                    this->written++;
+                }
+            }
+
+            uint64_t written = 0;
+        };
+
+        CountingLogSink* counting = new CountingLogSink();
+        logger.AddSink(counting);
+
+        // filling the buffer without the logger thread catching up drops messages, but never blocks
+        for (uint32_t i = 0; i < 1000; i++) {
+            Log("%", i);
+        }
+
+        logger.Flush();
+        CELL_ASSERT(memory->GetMessages().GetCount() == 4);
+        CELL_ASSERT(logger.GetDroppedCount() > 0 && counting->written + logger.GetDroppedCount() == 1000);
+    }
+
+#ifdef CELL_CORE_PROFILER
+    // scopes and counters are compiled out without the profiler, so there'd be nothing to capture
+    {
+        Profiler profiler(8);
+
+        {
+            CELL_PROFILE_SCOPE("before");
+            CELL_PROFILE_SCOPE("before as well");
+        }
+
+        profiler.Start();
+        CELL_PROFILE_COUNTER("frame", "draw calls", 12);
+
+        {
+            CELL_PROFILE_SCOPE("outer");
+
+            {
+                CELL_PROFILE_SCOPE("inner \"quoted\"");
+            }
+        }
+
+        Thread profiling([](void* parameter) {
+            CELL_PROFILE_FUNCTION();
+            (void)(parameter);
+        });
+
+        profiling.Join();
+
+        // one more scope fits into the remaining room, the rest is dropped
+        for (uint32_t i = 0; i < 8; i++) {
+            CELL_PROFILE_SCOPE("filler");
+        }
+
+        profiler.Stop();
+
+        {
+            CELL_PROFILE_SCOPE("after");
+        }
+
+        CELL_ASSERT(profiler.GetDroppedCount() == 7);
+
+        const Collection::List<uint8_t> chrome = profiler.Export(TraceFormat::Chrome);
+        CELL_ASSERT(CountOccurrences(chrome, "\"ph\":\"B\"", 8) == 4);
+        CELL_ASSERT(CountOccurrences(chrome, "\"ph\":\"E\"", 8) == 4);
+        CELL_ASSERT(CountOccurrences(chrome, "\"args\":{\"draw calls\":12}", 24) == 1);
+        CELL_ASSERT(CountOccurrences(chrome, "\"inner \\\"quoted\\\"\"", 18) == 1);
+        CELL_ASSERT(CountOccurrences(chrome, "before", 6) == 0 && CountOccurrences(chrome, "after", 5) == 0);
+
+        const Collection::List<uint8_t> perfetto = profiler.Export(TraceFormat::Perfetto);
+        CELL_ASSERT(perfetto.GetCount() > 0 && perfetto[0] == 0x0a);
+        CELL_ASSERT(CountOccurrences(perfetto, "filler", 6) == 1);
+        CELL_ASSERT(CountOccurrences(perfetto, "frame draw calls", 16) == 1);
+    }
+#endif
+
+    Wrapped<PerfCounters*, Result> countersResult = PerfCounters::Open();
+    if (countersResult.IsValid()) {
+        ScopedObject<PerfCounters> counters = countersResult.Unwrap();
+
+        PerfSample sample;
+        uint64_t sum = 0;
+
+        {
+            PerfScope scope(*(PerfCounters*)counters, "sum", 100000, &sample);
+
+            for (uint64_t i = 0; i < 100000; i++) {
+                sum += i * i;
+                __asm__ volatile("" : "+r"(sum));
+            }
+        }
+
+        CELL_ASSERT(sum > 0);
+        CELL_ASSERT(!sample.IsAvailable(PerfCounter::Instructions) || sample.Get(PerfCounter::Instructions) >= 100000);
+        CELL_ASSERT(!sample.IsAvailable(PerfCounter::Cycles) || !sample.IsAvailable(PerfCounter::Instructions) || sample.GetInstructionsPerCycle() > 0.0);
+        CELL_ASSERT(!sample.ToString(100000).IsEmpty());
+    } else {
+        // counting may be off limits, e.g. in containers, or unavailable on this platform
+        CELL_ASSERT(countersResult.Result() == Result::AccessDenied || countersResult.Result() == Result::Unsupported);
+    }
+
+    {
+        MetricCounter counter("test.counter");
+        MetricGauge gauge("test.gauge");
+        MetricHistogram histogram("test.histogram");
+
+        CELL_ASSERT(MetricRegistry::Find("test.counter") == &counter);
+        CELL_ASSERT(MetricRegistry::Find("test.missing") == nullptr);
+
+        Thread counting([](void* parameter) {
+            for (size_t i = 0; i < 1000; i++) {
+                ((MetricCounter*)parameter)->Add();
+            }
+        }, &counter);
+
+        counter.Add(500);
+        counting.Join();
+        CELL_ASSERT(counter.GetValue() == 1500);
+
+        gauge.Set(2.5);
+        gauge.Add(-1.0);
+        CELL_ASSERT(gauge.GetValue() == 1.5);
+
+        for (uint64_t i = 1; i <= 10000; i++) {
+            histogram.Record(i);
+        }
+
+        HistogramSnapshot snapshot = histogram.Snapshot();
+        CELL_ASSERT(snapshot.count == 10000 && snapshot.minimum == 1 && snapshot.maximum == 10000);
+        CELL_ASSERT(snapshot.GetMean() == 5000.5);
+
+        // within the precision of a bucket, under 1% above 256
+        const uint64_t median = snapshot.GetPercentile(50.0);
+        const uint64_t tail = snapshot.GetPercentile(99.9);
+        CELL_ASSERT(median >= 5000 && median <= 5050);
+        CELL_ASSERT(tail >= 9990 && tail <= 10000);
+        CELL_ASSERT(snapshot.GetPercentile(100.0) == 10000);
+
+        ScopedBlock<char> text = MetricRegistry::ExportText().ToCharPointer();
+        CELL_ASSERT(strstr(text, "counter test.counter 1500\n") != nullptr);
+        CELL_ASSERT(strstr(text, "gauge test.gauge 1.5\n") != nullptr);
+        CELL_ASSERT(strstr(text, "histogram test.histogram count=10000 min=1") != nullptr);
+
+        ScopedBlock<char> json = MetricRegistry::ExportJSON().ToCharPointer();
+        CELL_ASSERT(strstr(json, "\"test.counter\":1500") != nullptr);
+        CELL_ASSERT(strstr(json, "\"test.histogram\":{\"count\":10000,\"min\":1") != nullptr);
+
+        histogram.Reset();
+        CELL_ASSERT(histogram.Snapshot().count == 0);
+    }
+
+    CELL_ASSERT(MetricRegistry::Find("test.counter") == nullptr);
 }
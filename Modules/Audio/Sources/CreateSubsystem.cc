@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Audio/Subsystem.hh>
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/System/Panic.hh>
 
 #ifdef CELL_PLATFORM_WINDOWS
@@ -17,6 +18,8 @@
 namespace Cell::Audio {
 
 Wrapped<ISubsystem*, Result> CreateSubsystem(const String& title) {
+    CELL_MEMORY_TAG(Audio);
+
 #ifdef CELL_PLATFORM_WINDOWS
     Wrapped<Implementations::WASAPI::Subsystem*, Result> result = Implementations::WASAPI::Subsystem::New(title);
 #elif CELL_PLATFORM_MACOS
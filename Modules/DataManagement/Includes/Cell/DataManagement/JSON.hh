@@ -6,6 +6,7 @@
 #include <Cell/Collection/List.hh>
 #include <Cell/DataManagement/Result.hh>
 #include <Cell/String.hh>
+#include <Cell/StringView.hh>
 
 namespace Cell::DataManagement::JSON {
 
@@ -20,7 +21,8 @@ enum class Type : uint8_t {
 
 struct Value {
     // Name of the value. This is empty for values within array type values.
-    String name;
+    // Like string values, it refers to the text of the document the value is part of.
+    StringView name;
 
     // Indicates the type of value stored.
     Type type;
@@ -28,7 +30,7 @@ struct Value {
     union {
         Value* object;
         Value* array;
-        String* string;
+        StringView string = StringView();
         double number;
         bool boolean;
     };
@@ -40,14 +42,16 @@ struct Value {
 
 class Document : public Object {
 public:
-    CELL_FUNCTION static Wrapped<Document*, Result> Parse(const String& document);
+    // Parses the given text. The document keeps a copy of it, which names and string values refer to instead of being copied individually.
+    CELL_FUNCTION static Wrapped<Document*, Result> Parse(const StringView text);
     CELL_FUNCTION ~Document();
 
     CELL_FUNCTION Value GetRoot();
 
 private:
-    CELL_FUNCTION_INTERNAL Document(Value r) : root(r) { }
+    CELL_FUNCTION_INTERNAL Document(const StringView text) : text(text) { }
 
+    String text;
     Value root;
 };
 
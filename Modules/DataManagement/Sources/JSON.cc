@@ -3,9 +3,8 @@
 
 #include <Cell/Scoped.hh>
 #include <Cell/DataManagement/JSON.hh>
-
-#include <string.h>
-#include <stdlib.h>
+#include <Cell/Memory/Tracking.hh>
+#include <Cell/System/Profiler.hh>
 
 namespace Cell::DataManagement::JSON {
 
@@ -15,9 +14,9 @@ enum class seekResult {
     ReachedEOF,
 };
 
-seekResult seekNextToken(size_t& position, const char token, const char* document, size_t starting_offset = 0, bool ignoreJustEmptySpace = true) {
+seekResult seekNextToken(size_t& position, const char token, const StringView document, size_t starting_offset = 0, bool ignoreJustEmptySpace = true) {
     size_t offset = starting_offset;
-    for (; offset < strlen(document); offset++) {
+    for (; offset < document.GetSize(); offset++) {
         if (document[offset] == token) {
             break;
         }
@@ -31,7 +30,7 @@ seekResult seekNextToken(size_t& position, const char token, const char* documen
         }
     }
 
-    if (offset == strlen(document) && document[offset] != token) {
+    if (offset >= document.GetSize()) {
         return seekResult::ReachedEOF;
     }
 
@@ -39,9 +38,13 @@ seekResult seekNextToken(size_t& position, const char token, const char* documen
     return seekResult::Success;
 }
 
-CELL_FUNCTION_INTERNAL size_t parseObject(Collection::List<Value>& values, const char* document, const size_t size, uint8_t& recursionCounter);
+CELL_FUNCTION_INTERNAL bool isNumberCharacter(const char character) {
+    return (character >= '0' && character <= '9') || character == '-' || character == '+' || character == '.' || character == 'e' || character == 'E';
+}
+
+CELL_FUNCTION_INTERNAL size_t parseObject(Collection::List<Value>& values, const StringView document, uint8_t& recursionCounter);
 
-CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, const size_t size, uint8_t& recursionCounter) {
+CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const StringView document, uint8_t& recursionCounter) {
     // TODO: instead of panicking, we should inform the caller that this JSON is kinda garbage
     CELL_ASSERT(recursionCounter < 25);
 
@@ -58,14 +61,14 @@ CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, con
 
         value.type   = Type::String;
         value.count  = 0;
-        value.string = new String(document + position + 1, stringEnd - 1);
+        value.string = document.Substring(position + 1, stringEnd - position - 1).Unwrap();
 
         position = stringEnd + 1;
         break;
     }
 
     case 't': { // true boolean
-        CELL_ASSERT(strncmp(document + position, "true", 4) == 0);
+        CELL_ASSERT(document.SkipTo(position).BeginsWith("true"));
 
         value.type = Type::Boolean;
         value.count = 0;
@@ -76,7 +79,7 @@ CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, con
     }
 
     case 'f': { // false boolean
-        CELL_ASSERT(strncmp(document + position, "false", 5) == 0);
+        CELL_ASSERT(document.SkipTo(position).BeginsWith("false"));
 
         value.type = Type::Boolean;
         value.count = 0;
@@ -87,7 +90,7 @@ CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, con
     }
 
     case 'n': { // null
-        CELL_ASSERT(strncmp(document + position, "null", 4) == 0);
+        CELL_ASSERT(document.SkipTo(position).BeginsWith("null"));
 
         value.type = Type::Null;
         value.count = 0;
@@ -131,7 +134,7 @@ CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, con
         }
 
         Collection::List<Value> elements;
-        size_t endPosition = parseObject(elements, document + position, size - position, recursionCounter);
+        size_t endPosition = parseObject(elements, document.SkipTo(position), recursionCounter);
 
         value.type = Type::Object;
         value.count = elements.GetCount();
@@ -146,32 +149,19 @@ CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, con
     }
 
     default: { // assume number, fail if not
-        size_t numberEnd = 0;
-        seekResult = seekNextToken(numberEnd, ',', document, position + 1, false);
-        switch (seekResult) {
-        case seekResult::Success: {
-            break;
+        size_t numberEnd = position;
+        while (numberEnd < document.GetSize() && isNumberCharacter(document[numberEnd])) {
+            numberEnd++;
         }
 
-        case seekResult::ReachedEOF: {
-            seekResult = seekNextToken(numberEnd, ' ', document, position + 1, false); // this fails if there's no empty space or newline
-            CELL_ASSERT(seekResult == seekResult::Success);
-            break;
-        }
-
-        default: {
-            CELL_UNREACHABLE;
-        }
-        }
-
-        ScopedBlock<char> numberString = Memory::Allocate<char>(numberEnd - position + 1);
-        Memory::Copy<char>(numberString, document + position, numberEnd - position);
+        Wrapped<double, StringDetails::Result> number = document.Substring(position, numberEnd - position).Unwrap().AsDouble();
+        CELL_ASSERT(number.IsValid());
 
         value.type = Type::Number;
         value.count = 0;
-        value.number = strtod(numberString, nullptr);
+        value.number = number.Unwrap();
 
-        position = numberEnd + 1;
+        position = numberEnd;
         break;
     }
     }
@@ -182,14 +172,14 @@ CELL_FUNCTION_INTERNAL size_t parseValue(Value& value, const char* document, con
 }
 
 // Assumes position is past opening brace
-size_t parseObject(Collection::List<Value>& values, const char* document, const size_t size, uint8_t& recursionCounter) {
+size_t parseObject(Collection::List<Value>& values, const StringView document, uint8_t& recursionCounter) {
     // TODO: instead of panicking, we should inform the caller that this JSON is kinda garbage
     CELL_ASSERT(recursionCounter < 25);
 
     recursionCounter++;
 
     size_t position = 0;
-    while (position < size) {
+    while (position < document.GetSize()) {
         Value value;
 
         // find the beginning of the key
@@ -201,30 +191,30 @@ size_t parseObject(Collection::List<Value>& values, const char* document, const
         seekResult = seekNextToken(end, '"', document, position + 1, false);
         CELL_ASSERT(seekResult == seekResult::Success);
 
-        // allocate it
-        value.name = String(document + position + 1, end - position - 1);
+        // refer to it
+        value.name = document.Substring(position + 1, end - position - 1).Unwrap();
 
         // move on
         position = end + 1;
         CELL_ASSERT(document[position++] == ':');
 
         // ignore empty space or newline
-        while (document[position] == ' ' || document[position] == '\n') {
+        while (position < document.GetSize() && (document[position] == ' ' || document[position] == '\n')) {
             position++;
         }
 
-        position += parseValue(value, document + position, size - position, recursionCounter);
+        position += parseValue(value, document.SkipTo(position), recursionCounter);
 
-        values.Append(value);
+        values.Append(Utilities::Move(value));
 
         CELL_ASSERT(document[position] == ',' || document[position] == ' ' || document[position] == '\n');
         position++;
 
-        while (document[position] == ' ' || document[position] == '\n') {
+        while (position < document.GetSize() && (document[position] == ' ' || document[position] == '\n')) {
             position++;
         }
 
-        if (document[position] == '}') {
+        if (position >= document.GetSize() || document[position] == '}') {
             break;
         }
     }
@@ -233,34 +223,39 @@ size_t parseObject(Collection::List<Value>& values, const char* document, const
     return position;
 }
 
-Wrapped<Document*, Result> Document::Parse(const String& string) {
-    if (string.IsEmpty()) {
+Wrapped<Document*, Result> Document::Parse(const StringView text) {
+    CELL_MEMORY_TAG(DataManagement);
+    CELL_PROFILE_SCOPE("JSON::Document::Parse");
+
+    if (text.IsEmpty()) {
         return Result::InvalidParameters;
     }
 
-    const char* document = string.ToRawPointer();
-
     // seek to beginning
     size_t position = 0;
-    seekResult seekResult = seekNextToken(position, '{', document);
+    seekResult seekResult = seekNextToken(position, '{', text);
     if (seekResult != seekResult::Success) {
         return Result::InvalidData;
     }
 
     position++;
 
+    // names and string values are slices of the document's own copy of the text
+    Document* document = new Document(text);
+    const StringView view = document->text;
+
     Collection::List<Value> values;
     uint8_t recursionCounter = 0;
-    parseObject(values, document + position, string.GetSize() - position, recursionCounter);
+    parseObject(values, view.SkipTo(position), recursionCounter);
 
-    Value root = { .name = "", .type = Type::Object, .object = nullptr, .count = values.GetCount() };
+    document->root = { .name = "", .type = Type::Object, .object = nullptr, .count = values.GetCount() };
 
-    root.object = Memory::Allocate<Value>(values.GetCount());
+    document->root.object = Memory::Allocate<Value>(values.GetCount());
     for (size_t i = 0; i < values.GetCount(); i++) {
-        root.object[i] = values[i];
+        document->root.object[i] = values[i];
     }
 
-    return new Document(root);
+    return document;
 }
 
 Document::~Document() {
@@ -5,8 +5,11 @@
 #include <Cell/DataManagement/Checksum.hh>
 #include <Cell/DataManagement/Texture.hh>
 #include <Cell/DataManagement/zlib.hh>
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/Memory/UnownedBlock.hh>
 #include <Cell/System/Log.hh>
+#include <Cell/System/Metrics.hh>
+#include <Cell/System/Profiler.hh>
 #include <Cell/Utilities/Byteswap.hh>
 #include <Cell/Utilities/Preprocessor.hh>
 #include <Cell/Utilities/Reader.hh>
@@ -15,6 +18,10 @@
 
 namespace Cell::DataManagement {
 
+// Decoding time and throughput, in bytes of decoded pixels.
+static System::MetricHistogram decodeTime("data.png_decode_us");
+static System::MetricCounter decodedBytes("data.png_decoded_bytes");
+
 #define U64_SHIFT(v, b) (((uint64_t)(v)) << b)
 
 struct CELL_PACKED(1) ChunkHeader {
@@ -63,7 +70,7 @@ const uint32_t gAMAIdentifier = 'g' | 'A' << 8 | 'M' << 16 | 'A' << 24;
 const uint32_t pHYsIdentifier = 'p' | 'H' << 8 | 'Y' << 16 | 's' << 24;
 
 CELL_FUNCTION_INTERNAL uint32_t GenerateCRCForChunk(const uint32_t& identifier, const uint8_t* data, const size_t& size) {
-    uint8_t* buffer = Memory::Allocate<uint8_t>(sizeof(uint32_t) + size);
+    uint8_t* buffer = Memory::AllocateUninitialized<uint8_t>(sizeof(uint32_t) + size);
 
     *(uint32_t*)buffer = identifier;
     Memory::Copy<uint8_t>(buffer + sizeof(uint32_t), data, size);
@@ -151,6 +158,10 @@ CELL_FUNCTION_INTERNAL uint8_t PerformFilter(const uint8_t& filter, const uint8_
 }
 
 Wrapped<Texture*, Result> Texture::FromPNG(const Memory::IBlock& block) {
+    CELL_MEMORY_TAG(DataManagement);
+    CELL_PROFILE_SCOPE("Texture::FromPNG");
+    System::MetricTimer decodeTimer(decodeTime);
+
     Utilities::Reader reader(block);
 
     // magic check
@@ -213,7 +224,7 @@ Wrapped<Texture*, Result> Texture::FromPNG(const Memory::IBlock& block) {
 
             imageDataSize = chunkHeader.size;
 
-            imageData = Memory::Allocate<uint8_t>(imageDataSize);
+            imageData = Memory::AllocateUninitialized<uint8_t>(imageDataSize);
             reader.ReadBytes(imageData, imageDataSize, false);
             break;
         }
@@ -231,7 +242,7 @@ Wrapped<Texture*, Result> Texture::FromPNG(const Memory::IBlock& block) {
 
             paletteDataSize = chunkHeader.size;
 
-            paletteData = Memory::Allocate<uint8_t>(paletteDataSize);
+            paletteData = Memory::AllocateUninitialized<uint8_t>(paletteDataSize);
             reader.ReadBytes(paletteData, paletteDataSize, false);
             break;
         }
@@ -252,7 +263,7 @@ Wrapped<Texture*, Result> Texture::FromPNG(const Memory::IBlock& block) {
         }
 
         CELL_ASSERT(chunkHeader.size > 0);
-        uint8_t* chunkData = Memory::Allocate<uint8_t>(chunkHeader.size);
+        uint8_t* chunkData = Memory::AllocateUninitialized<uint8_t>(chunkHeader.size);
         reader.ReadBytes(chunkData, chunkHeader.size);
 
         const uint32_t crc = reader.Read<uint32_t>();
@@ -308,7 +319,7 @@ Wrapped<Texture*, Result> Texture::FromPNG(const Memory::IBlock& block) {
 
     // TODO: the entire filter system is *completely broken* right now
 
-    uint32_t* rgba = Memory::Allocate<uint32_t>(header.width * header.height);
+    uint32_t* rgba = Memory::AllocateUninitialized<uint32_t>(header.width * header.height);
 
     size_t pixelIndex = 0;
     for (size_t y = 0; y < header.height; y++) {
@@ -385,6 +396,7 @@ Wrapped<Texture*, Result> Texture::FromPNG(const Memory::IBlock& block) {
 
     Memory::Free(imageData);
 
+    decodedBytes.Add((uint64_t)header.width * header.height * sizeof(uint32_t));
     return new Texture(header.width, header.height, 1, rgba);
 }
 
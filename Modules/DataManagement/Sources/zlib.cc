@@ -3,18 +3,23 @@
 
 #include <Cell/Scoped.hh>
 #include <Cell/DataManagement/zlib.hh>
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/System/Log.hh>
+#include <Cell/System/Profiler.hh>
 
 #include <zlib-ng.h>
 
 namespace Cell::DataManagement {
 
 Wrapped<uint8_t*, Result> zlibDecompress(const Memory::IBlock& input, const size_t outSize) {
+    CELL_PROFILE_SCOPE("zlibDecompress");
+
     if (input.GetSize() < 7 || outSize < input.GetSize()) {
         return Result::InvalidSize;
     }
 
-    uint8_t* output = Memory::Allocate<uint8_t>(outSize);
+    CELL_MEMORY_TAG(DataManagement);
+    uint8_t* output = Memory::AllocateUninitialized<uint8_t>(outSize);
 
     size_t capacity = outSize;
     const int32_t result = zng_uncompress(output, &capacity, input.AsBytes(), input.GetSize());
@@ -45,6 +50,11 @@ Wrapped<uint8_t*, Result> zlibDecompress(const Memory::IBlock& input, const size
 
     CELL_ASSERT(capacity <= outSize);
 
+    // callers may pass a larger size than the data decompresses to, and read the whole buffer
+    if (capacity < outSize) {
+        Memory::Clear(output + capacity, outSize - capacity);
+    }
+
     return output;
 }
 
@@ -16,8 +16,7 @@ using namespace Cell::System;
 void PrintValue(JSON::Value value, const bool isRoot = false, const bool isArray = false) {
     switch (value.type) {
     case JSON::Type::String: {
-        ScopedBlock<char> string = value.string->ToCharPointer();
-        Log("%: %", isArray ? "-" : value.name, &string);
+        Log("%: %", isArray ? "-" : value.name, value.string);
         break;
     }
 
@@ -1,12 +1,15 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/OpenXR/Instance.hh>
 #include <Cell/System/Panic.hh>
 
 namespace Cell::OpenXR {
 
 Wrapped<Instance*, Result> Instance::New() {
+    CELL_MEMORY_TAG(OpenXR);
+
     const XrApplicationInfo applicationInfo = {
         .applicationName    = "Cell",
         .applicationVersion = 1,
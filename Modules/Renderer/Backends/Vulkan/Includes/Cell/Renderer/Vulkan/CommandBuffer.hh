@@ -3,8 +3,9 @@
 
 #pragma once
 
-#include <Cell/Collection/Enumerable.hh>
+#include <Cell/Collection/Span.hh>
 #include <Cell/Renderer/Vulkan/Device.hh>
+#include <Cell/System/TaskScheduler.hh>
 
 #include <Cell/Renderer/Vulkan/CommandParameters/Binding.hh>
 #include <Cell/Renderer/Vulkan/CommandParameters/Copy.hh>
@@ -54,14 +55,18 @@ public:
     CELL_FUNCTION Result Reset();
 
     // Writes a series of commands to the buffer.
-    CELL_FUNCTION Result Write(const Collection::IEnumerable<const Command>& commands);
+    CELL_FUNCTION Result Write(const Collection::Span<const Command> commands);
 
     // Begins recording, writes a series of commands, and ends recording this buffer, in one pass.
-    CELL_FUNCTION Result WriteSinglePass(const Collection::IEnumerable<const Command>& commands);
+    CELL_FUNCTION Result WriteSinglePass(const Collection::Span<const Command> commands);
 
     // Submits this buffer for synchronous execution.
     CELL_FUNCTION Result Submit();
 
+    // Submits this buffer for execution, and suspends the awaiting coroutine until it has finished, rather than blocking.
+    // The buffer has to outlive the task.
+    CELL_FUNCTION System::Task<Result> SubmitAsync(System::TaskScheduler& scheduler);
+
     // Submits this buffer for drawing to the given target, using the target's synchronization capabilities, if available.
     CELL_FUNCTION Result Submit(IRenderTarget* CELL_NONNULL target);
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <Cell/Collection/InlineList.hh>
 #include <Cell/Shell/Shell.hh>
 #include <Cell/Renderer/Vulkan/RenderTarget.hh>
 
@@ -22,6 +23,9 @@ enum class Stage : uint8_t {
     Fragment
 };
 
+// Storage for per image swapchain resources. Swapchains rarely have more than a handful of images, so these stay inline.
+template <typename T> using SwapchainImageList = Collection::InlineList<T, 4>;
+
 class Device : public NoCopyObject {
 friend Instance;
 
@@ -99,8 +103,8 @@ private:
 
     struct SwapchainData {
         VkSwapchainKHR swapchain;
-        Collection::List<VkImage> images;
-        Collection::List<VkImageView> views;
+        SwapchainImageList<VkImage> images;
+        SwapchainImageList<VkImageView> views;
     };
 
     CELL_FUNCTION Wrapped<VkImageView, Result> CreateImageView(VkImage CELL_NONNULL image,
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <Cell/Collection/InlineList.hh>
 #include <Cell/Collection/List.hh>
+#include <Cell/Collection/Span.hh>
 #include <Cell/Mathematics/Vector2.hh>
 #include <Cell/Mathematics/Quaternion.hh>
 #include <Cell/Renderer/Vulkan/Buffer.hh>
@@ -61,7 +63,7 @@ public:
     CELL_FUNCTION Result AddMultiShader(const Memory::IBlock& data);
 
     // Adds resources for shaders to this pipeline.
-    CELL_FUNCTION Result AddResources(const Collection::IEnumerable<ResourceBinding>& resBindings, const Collection::IEnumerable<ResourceDescriptor>& resDescriptors);
+    CELL_FUNCTION Result AddResources(const Collection::Span<const ResourceBinding> resBindings, const Collection::Span<const ResourceDescriptor> resDescriptors);
 
     // Finalizes the pipeline data into a proper pipeline.
     CELL_FUNCTION Result Finalize();
@@ -94,7 +96,7 @@ private:
     VkPipeline pipeline = nullptr;
 
     Collection::List<PipelineResource> resources;
-    Collection::List<VkPipelineShaderStageCreateInfo> stages;
+    Collection::InlineList<VkPipelineShaderStageCreateInfo, 4> stages;
     Collection::List<VkShaderModule> shaders;
 };
 
@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include <Cell/Collection/List.hh>
+#include <Cell/Collection/InlineList.hh>
 #include <Cell/Renderer/Vulkan/Image.hh>
 #include <Cell/Renderer/Vulkan/RenderTarget.hh>
 #include <Cell/Shell/Shell.hh>
@@ -56,10 +56,10 @@ public:
 private:
     CELL_FUNCTION_INTERNAL WSITarget(VkSurfaceKHR s, const uint8_t d, const VkSurfaceCapabilitiesKHR& c,
                                      const VkSurfaceFormatKHR f, const VkPresentModeKHR p, const VkExtent2D e,
-                                     VkSwapchainKHR sc, Collection::List<VkImage>& i,
-                                     Collection::List<VkImageView>& v, Image*& di,
-                                     Collection::List<VkSemaphore>& ia, Collection::List<VkSemaphore>& rf,
-                                     Collection::List<VkFence>& iff, Device* de, Shell::IShell* sh)
+                                     VkSwapchainKHR sc, SwapchainImageList<VkImage>& i,
+                                     SwapchainImageList<VkImageView>& v, Image*& di,
+                                     SwapchainImageList<VkSemaphore>& ia, SwapchainImageList<VkSemaphore>& rf,
+                                     SwapchainImageList<VkFence>& iff, Device* de, Shell::IShell* sh)
         : surface(s), capabilities(c), format(f), mode(p), extent(e),
           swapchain(sc), depth(d), swapchainImages(i), swapchainImageViews(v),
           imageAvailable(ia), renderFinished(rf), inFlightFrames(iff), depthImage(di),
@@ -73,12 +73,12 @@ private:
     VkSwapchainKHR swapchain;
     uint8_t depth;
 
-    Collection::List<VkImage> swapchainImages;
-    Collection::List<VkImageView> swapchainImageViews;
+    SwapchainImageList<VkImage> swapchainImages;
+    SwapchainImageList<VkImageView> swapchainImageViews;
 
-    Collection::List<VkSemaphore> imageAvailable;
-    Collection::List<VkSemaphore> renderFinished;
-    Collection::List<VkFence> inFlightFrames;
+    SwapchainImageList<VkSemaphore> imageAvailable;
+    SwapchainImageList<VkSemaphore> renderFinished;
+    SwapchainImageList<VkFence> inFlightFrames;
 
     Image* depthImage;
 
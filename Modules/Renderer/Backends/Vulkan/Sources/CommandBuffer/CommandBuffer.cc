@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Renderer/Vulkan/CommandBuffer.hh>
+#include <Cell/System/Profiler.hh>
 
 namespace Cell::Renderer::Vulkan {
 
@@ -87,7 +88,9 @@ Result CommandBuffer::Reset() {
     return Result::Success;
 }
 
-Result CommandBuffer::WriteSinglePass(const Collection::IEnumerable<const Command>& commands) {
+Result CommandBuffer::WriteSinglePass(const Collection::Span<const Command> commands) {
+    CELL_PROFILE_SCOPE("CommandBuffer::WriteSinglePass");
+
     if (this->recordState == RecordState::Recorded) {
         const Result result = this->Reset();
         if (result != Result::Success) {
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Renderer/Vulkan/CommandBuffer.hh>
+#include <Cell/System/Profiler.hh>
 
 namespace Cell::Renderer::Vulkan {
 
 Result CommandBuffer::Submit() {
+    CELL_PROFILE_SCOPE("CommandBuffer::Submit");
+
     CELL_ASSERT(this->recordState == RecordState::Recorded);
 
     const VkFenceCreateInfo fenceInfo = {
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <Cell/Renderer/Vulkan/CommandBuffer.hh>
+
+namespace Cell::Renderer::Vulkan {
+
+struct PendingFence {
+    VkDevice device;
+    VkFence fence;
+};
+
+System::Task<Result> CommandBuffer::SubmitAsync(System::TaskScheduler& scheduler) {
+    CELL_ASSERT(this->recordState == RecordState::Recorded);
+
+    const VkFenceCreateInfo fenceInfo = {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0
+    };
+
+    VkFence fence = nullptr;
+    VkResult result = vkCreateFence(this->device->device, &fenceInfo, nullptr, &fence);
+    switch (result) {
+    case VK_SUCCESS: {
+        break;
+    }
+
+    case VK_ERROR_OUT_OF_HOST_MEMORY: {
+        co_return Result::OutOfHostMemory;
+    }
+
+    case VK_ERROR_OUT_OF_DEVICE_MEMORY: {
+        co_return Result::OutOfDeviceMemory;
+    }
+
+    default: {
+        System::Panic("vkCreateFence failed");
+    }
+    }
+
+    const VkSubmitInfo submitInfo = {
+        .sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext                = nullptr,
+
+        .waitSemaphoreCount   = 0,
+        .pWaitSemaphores      = nullptr,
+        .pWaitDstStageMask    = nullptr,
+
+        .commandBufferCount   = 1,
+        .pCommandBuffers      = &this->buffer,
+
+        .signalSemaphoreCount = 0,
+        .pSignalSemaphores    = nullptr
+    };
+
+    result = vkQueueSubmit(this->queueRef, 1, &submitInfo, fence);
+    switch (result) {
+    case VK_SUCCESS: {
+        break;
+    }
+
+    case VK_ERROR_OUT_OF_HOST_MEMORY: {
+        vkDestroyFence(this->device->device, fence, nullptr);
+        co_return Result::OutOfHostMemory;
+    }
+
+    case VK_ERROR_OUT_OF_DEVICE_MEMORY: {
+        vkDestroyFence(this->device->device, fence, nullptr);
+        co_return Result::OutOfDeviceMemory;
+    }
+
+    case VK_ERROR_DEVICE_LOST: {
+        vkDestroyFence(this->device->device, fence, nullptr);
+        co_return Result::DeviceLost;
+    }
+
+    default: {
+        System::Panic("vkQueueSubmit failed");
+    }
+    }
+
+    // the fence is polled from the scheduler's thread, instead of blocking a thread in vkWaitForFences
+    PendingFence pending = { this->device->device, fence };
+    co_await scheduler.WaitUntil([](void* parameter) {
+        const PendingFence* pending = (const PendingFence*)parameter;
+        return vkGetFenceStatus(pending->device, pending->fence) != VK_NOT_READY;
+    }, &pending);
+
+    result = vkGetFenceStatus(this->device->device, fence);
+    vkDestroyFence(this->device->device, fence, nullptr);
+
+    switch (result) {
+    case VK_SUCCESS: {
+        break;
+    }
+
+    case VK_ERROR_OUT_OF_HOST_MEMORY: {
+        co_return Result::OutOfHostMemory;
+    }
+
+    case VK_ERROR_OUT_OF_DEVICE_MEMORY: {
+        co_return Result::OutOfDeviceMemory;
+    }
+
+    case VK_ERROR_DEVICE_LOST: {
+        co_return Result::DeviceLost;
+    }
+
+    default: {
+        System::Panic("vkGetFenceStatus failed");
+    }
+    }
+
+    co_return Result::Success;
+}
+
+}
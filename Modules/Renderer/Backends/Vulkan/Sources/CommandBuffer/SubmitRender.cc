@@ -3,10 +3,13 @@
 
 #include <Cell/Renderer/Vulkan/CommandBuffer.hh>
 #include <Cell/Renderer/Vulkan/Pipeline.hh>
+#include <Cell/System/Profiler.hh>
 
 namespace Cell::Renderer::Vulkan {
 
 Result CommandBuffer::Submit(IRenderTarget* target) {
+    CELL_PROFILE_SCOPE("CommandBuffer::Submit");
+
     CELL_ASSERT(this->recordState == RecordState::Recorded);
     CELL_ASSERT(this->queueRef == this->device->deviceQueueGraphics);
 
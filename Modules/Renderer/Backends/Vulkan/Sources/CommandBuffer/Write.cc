@@ -7,7 +7,7 @@ namespace Cell::Renderer::Vulkan {
 
 using namespace CommandParameters;
 
-Result CommandBuffer::Write(const Collection::IEnumerable<const Command>& commands) {
+Result CommandBuffer::Write(const Collection::Span<const Command> commands) {
     CELL_ASSERT(this->recordState == RecordState::Recording);
 
     for (const Command& command : commands) {
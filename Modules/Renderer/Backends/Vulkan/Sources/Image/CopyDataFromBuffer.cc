@@ -105,7 +105,7 @@ Result Image::CopyDataFromBuffer(Buffer* buffer) {
         .images               = &barrierSecondData
     };
 
-    const Collection::List<const Command> commands = {
+    const Command commands[] = {
         { CommandType::InsertBarrier,     &barrierFirstParameters },
         { CommandType::CopyBufferToImage, &copyParameters },
         { CommandType::InsertBarrier,     &barrierSecondParameters }
@@ -118,7 +118,7 @@ Result Image::CopyDataFromBuffer(Buffer* buffer) {
 
     ScopedObject<CommandBuffer> commandBuffer = commandBufferResult.Unwrap();
 
-    const Result result = commandBuffer->WriteSinglePass(commands);
+    const Result result = commandBuffer->WriteSinglePass(Collection::Array(&commands));
     if (result != Result::Success) {
         return result;
     }
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/Renderer/Vulkan/Instance.hh>
 
 #ifdef CELL_PLATFORM_WINDOWS
@@ -34,6 +35,8 @@ Wrapped<Instance*, Result> Instance::New() {
 }
 
 Wrapped<Instance*, Result> Instance::New(const char** extensions, const uint32_t count) {
+    CELL_MEMORY_TAG(Renderer);
+
     const VkApplicationInfo applicationInfo = {
         .sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO,
         .pNext              = nullptr,
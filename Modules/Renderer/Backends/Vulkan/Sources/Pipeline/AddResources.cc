@@ -1,7 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
-#include <Cell/Collection/Dictionary.hh>
+#include <Cell/Collection/HashMap.hh>
 #include <Cell/System/Log.hh>
 #include <Cell/Renderer/Vulkan/Pipeline.hh>
 
@@ -9,7 +9,7 @@ namespace Cell::Renderer::Vulkan {
 
 using namespace Collection;
 
-Result Pipeline::AddResources(const IEnumerable<ResourceBinding>& resBindings, const IEnumerable<ResourceDescriptor>& resDescriptors) {
+Result Pipeline::AddResources(const Span<const ResourceBinding> resBindings, const Span<const ResourceDescriptor> resDescriptors) {
     if (resBindings.IsEmpty() || resDescriptors.IsEmpty()) {
         return Result::InvalidParameters;
     }
@@ -101,20 +101,14 @@ Result Pipeline::AddResources(const IEnumerable<ResourceBinding>& resBindings, c
 
     // pool allocation
 
-    Collection::Dictionary<VkDescriptorType, uint32_t> countPerType;
+    Collection::HashMap<VkDescriptorType, uint32_t> countPerType;
     for (VkDescriptorSetLayoutBinding binding : bindings) {
-        Optional<size_t> position = countPerType.Has(binding.descriptorType);
-        if (position) {
-            countPerType.Set(position, countPerType.GetValue(position) + 1);
-            continue;
-        }
-
-        countPerType.Append(binding.descriptorType, 1);
+        countPerType.GetOrAdd(binding.descriptorType)++;
     }
 
     Collection::List<VkDescriptorPoolSize> poolSizes(countPerType.GetCount());
     for (size_t i = 0; i < countPerType.GetCount(); i++) {
-        poolSizes[i].descriptorCount = countPerType.GetValue(i) * setCount;
+        poolSizes[i].descriptorCount = countPerType[i] * setCount;
         poolSizes[i].type = countPerType.GetKey(i);
     }
 
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Renderer/Vulkan/WSITarget.hh>
+#include <Cell/System/Profiler.hh>
 
 namespace Cell::Renderer::Vulkan {
 
 Wrapped<AcquiredImage, Result> WSITarget::AcquireNext() {
+    CELL_PROFILE_SCOPE("WSITarget::AcquireNext");
+
     VkResult result = vkWaitForFences(this->device->device, 1, &this->inFlightFrames[this->renderFrameCounter], VK_TRUE, UINT64_MAX);
     switch (result) {
     case VK_SUCCESS: {
@@ -67,9 +67,9 @@ Wrapped<WSITarget*, Result> Device::CreateWSITarget(Shell::IShell* shell, const
         .flags = VK_FENCE_CREATE_SIGNALED_BIT
     };
 
-    Collection::List<VkSemaphore> imageAvailable(depth);
-    Collection::List<VkSemaphore> renderFinished(depth);
-    Collection::List<VkFence> inFlightFrames(depth);
+    SwapchainImageList<VkSemaphore> imageAvailable(depth);
+    SwapchainImageList<VkSemaphore> renderFinished(depth);
+    SwapchainImageList<VkFence> inFlightFrames(depth);
 
     VkResult result = VK_ERROR_UNKNOWN;
     for (size_t i = 0; i < depth; i++) {
@@ -90,7 +90,7 @@ Wrapped<Device::SwapchainData, Result> Device::CreateSwapchainForSurface(const S
     }
     }
 
-    Collection::List<VkImage> images(imageCount);
+    SwapchainImageList<VkImage> images(imageCount);
     result = vkGetSwapchainImagesKHR(this->device, swapchain, &imageCount, images.AsRaw());
     switch (result) {
     case VK_SUCCESS: {
@@ -114,7 +114,7 @@ Wrapped<Device::SwapchainData, Result> Device::CreateSwapchainForSurface(const S
 
     // Image view creation
 
-    Collection::List<VkImageView> views(imageCount);
+    SwapchainImageList<VkImageView> views(imageCount);
 
     for (uint32_t index = 0; index < imageCount; index++) {
         Wrapped<VkImageView, Result> viewResult = this->CreateImageView(images[index], info.format.format);
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: BSD-2-Clause
 
 #include <Cell/Renderer/Vulkan/WSITarget.hh>
+#include <Cell/System/Profiler.hh>
 
 namespace Cell::Renderer::Vulkan {
 
 Result WSITarget::Present() {
+    CELL_PROFILE_SCOPE("WSITarget::Present");
+
     const VkPresentInfoKHR presentInfo = {
         .sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
         .pNext              = nullptr,
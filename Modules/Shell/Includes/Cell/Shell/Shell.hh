@@ -4,7 +4,9 @@
 #pragma once
 
 #include <Cell/String.hh>
+#include <Cell/Collection/InlineList.hh>
 #include <Cell/Collection/List.hh>
+#include <Cell/Memory/Arena.hh>
 #include <Cell/Shell/Controller.hh>
 
 namespace Cell::Shell {
@@ -127,7 +129,13 @@ private:
     };
 
     Collection::List<RegisterInfo> registeredFunctions;
-    Collection::List<IController*> controllers;
+    Collection::InlineList<IController*, 4> controllers;
+
+    // Scratch memory for a single dispatch, released when it returns.
+    Memory::Arena dispatchArena { 4096 };
+
+    // Ticks at the start of the last dispatch, to tell the time between frames; zero before the first one.
+    uint64_t lastDispatchTicks = 0;
 };
 
 // Sets up the most suited shell implementation for the platform.
@@ -1,13 +1,19 @@
 // SPDX-FileCopyrightText: Copyright 2023-2024 Gloria G.
 // SPDX-License-Identifier: BSD-2-Clause
 
+#include <Cell/Memory/Tracking.hh>
 #include <Cell/Shell/Shell.hh>
 #include <Cell/System/Log.hh>
+#include <Cell/System/Metrics.hh>
+#include <Cell/System/Profiler.hh>
 
 #include <math.h>
 
 namespace Cell::Shell {
 
+// Time between dispatches, which applications run once per frame.
+static System::MetricHistogram frameTime("shell.frame_time_us");
+
 #define CONTROLLER_AXIS_CASE(axisName, reportName) case ControllerAxis::axisName: { if (fabs(report.reportName) > 0.1) { info.axis(report.reportName, info.userData); } break; }
 
 template <typename B> void handleButton(const B current, const B previous, const B match, ButtonFunction function, void* userData) {
@@ -20,6 +26,16 @@ template <typename B> void handleButton(const B current, const B previous, const
 }
 
 Result IShell::RunDispatch() {
+    CELL_MEMORY_TAG(Shell);
+    CELL_PROFILE_SCOPE("IShell::RunDispatch");
+
+    const uint64_t ticks = System::GetTicks();
+    if (this->lastDispatchTicks != 0) {
+        frameTime.Record(System::TicksToMicroseconds(ticks - this->lastDispatchTicks));
+    }
+
+    this->lastDispatchTicks = ticks;
+
     Result result = this->RunDispatchImpl();
     if (result != Result::Success) {
         return result;
@@ -29,8 +45,10 @@ Result IShell::RunDispatch() {
         return Result::Success;
     }
 
-    Collection::List<ControllerReport> reports;
-    Collection::List<ControllerReport> previousReports;
+    Memory::ScopedCheckpoint dispatchScope(this->dispatchArena);
+
+    Collection::List<ControllerReport> reports(this->dispatchArena);
+    Collection::List<ControllerReport> previousReports(this->dispatchArena);
 
     if (this->controllers.GetCount() > 0) {
         for (IController* controller : this->controllers) {
@@ -8,11 +8,14 @@
 #include <Cell/Audio/Renderer.hh>
 #include <Cell/IO/File.hh>
 #include <Cell/Memory/OwnedBlock.hh>
-#include <Cell/System/Timer.hh>
+#include <Cell/System/FramePacer.hh>
 
 using namespace Cell;
 using namespace Cell::Audio;
 
+// Shortest interval the audio thread wakes up at, in microseconds, used until the renderer reports its latency.
+constexpr uint32_t MinimumAudioInterval = 1000;
+
 void Example::AudioThread() {
     ScopedObject<ISubsystem> subsystem = CreateSubsystem("Cell").Unwrap();
 
@@ -38,20 +41,33 @@ void Example::AudioThread() {
 
     // BUG: CoreAudio hates this design, right now this doesn't track the samples played properly
     // TODO: build a better way of even doing buffers in the first place
+    // the latency is only known once the audio server reports it, and may change while playing
+    const auto getInterval = [&renderer]() -> uint64_t {
+        const uint32_t latency = renderer->GetLatency();
+        return latency > MinimumAudioInterval ? latency : MinimumAudioInterval;
+    };
+
+    System::FramePacer pacer(getInterval());
+
     uint32_t dataOffset = 0;
     while (this->shell->IsStillActive()) {
+        const uint64_t interval = getInterval();
+        if (interval != pacer.GetInterval()) {
+            pacer.SetInterval(interval);
+        }
+
         if (!this->controller->TriggeredAudio() || dataOffset >= size) {
             dataOffset = 0;
-            System::SleepPrecise(renderer->GetLatency());
+            pacer.Wait();
             continue;
         }
 
-        System::SleepPrecise(renderer->GetLatency());
+        pacer.Wait();
 
         // BUG: this doesn't function well on PulseAudio with particularly small samples
         const uint32_t offset = renderer->GetCurrentSampleOffset().Unwrap();
         if (offset > 0) {
-            System::SleepPrecise(renderer->GetLatency());
+            pacer.Wait();
             continue;
         }
 
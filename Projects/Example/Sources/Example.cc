@@ -5,6 +5,7 @@
 
 #include <Cell/IO/File.hh>
 #include <Cell/System/Entry.hh>
+#include <Cell/System/FramePacer.hh>
 #include <Cell/System/Log.hh>
 #include <Cell/System/Timer.hh>
 #include <Cell/Utilities/MinMaxClamp.hh>
@@ -12,6 +13,9 @@
 using namespace Cell;
 using namespace Cell::System;
 
+// Rate the shell dispatches events at, in Hz.
+constexpr uint32_t ShellDispatchRate = 240;
+
 void CellEntry(Reference<String> parameterString) {
     Example().Launch(parameterString.Unwrap());
 }
@@ -64,6 +68,8 @@ void Example::Launch(const String& parameterString) {
     Thread xr([](void* p) { ((Example*)p)->XRThread(); }, this, "XR Thread");
 #endif
 
+    FramePacer pacer(1000000 / ShellDispatchRate);
+
     uint64_t finishedTick = GetPreciseTickerValue();
     while (audio.IsActive()
            || renderer.IsActive()
@@ -81,7 +87,7 @@ void Example::Launch(const String& parameterString) {
         CELL_ASSERT(result == Shell::Result::Success);
 
         finishedTick = GetPreciseTickerValue();
-        SleepPrecise(400);
+        pacer.Wait();
     }
 
     audio.Join();
@@ -16,7 +16,11 @@ public:
     CELL_FUNCTION_INTERNAL void Launch(const Cell::String& parameterString);
 
     CELL_FUNCTION_INTERNAL inline Cell::String GetContentPath(const Cell::String& string) {
-        return Cell::String("./Projects/Example/Content") + string;
+        Cell::String path = "./Projects/Example/Content";
+        path.Reserve(path.GetSize() + string.GetSize());
+
+        path += string;
+        return path;
     }
 
 private:
@@ -8,6 +8,7 @@
 #include <Cell/Mathematics/Utilities.hh>
 #include <Cell/Memory/OwnedBlock.hh>
 #include <Cell/Memory/UnownedBlock.hh>
+#include <Cell/System/FramePacer.hh>
 #include <Cell/System/Timer.hh>
 #include <Cell/Utilities/MinMaxClamp.hh>
 #include <Cell/Renderer/Vulkan/WSITarget.hh>
@@ -18,6 +19,9 @@ using namespace Cell::Mathematics::Utilities;
 using namespace Cell::Renderer;
 using namespace Cell::Renderer::Vulkan;
 
+// Rate frames are rendered at, in Hz.
+constexpr uint32_t RendererFrameRate = 120;
+
 void Example::RendererThread() {
     Shell::Result shellResult = this->shell->IndicateStatus(Shell::ShellStatus::Working);
     CELL_ASSERT(shellResult == Shell::Result::Success);
@@ -124,12 +128,14 @@ void Example::RendererThread() {
     shellResult = this->shell->CaptureState(true);
     CELL_ASSERT(shellResult == Shell::Result::Success);
 
+    System::FramePacer pacer(1000000 / RendererFrameRate);
+
     uint64_t finishedTick = System::GetPreciseTickerValue();
     while (this->shell->IsStillActive()) {
         this->renderDeltaTime = Cell::Utilities::Minimum((System::GetPreciseTickerValue() - finishedTick) / 1000.f, 0.001f);
 
         if (!this->shell->IsInForeground()) {
-            System::SleepPrecise(400);
+            pacer.Wait();
             continue;
         }
 
@@ -162,6 +168,6 @@ void Example::RendererThread() {
         }
 
         finishedTick = System::GetPreciseTickerValue();
-        System::SleepPrecise(400);
+        pacer.Wait();
     }
 }
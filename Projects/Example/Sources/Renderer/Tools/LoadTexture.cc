@@ -21,7 +21,8 @@ Image* VulkanToolsLoadTexture(Device* device, const String& texturePath) {
     const size_t imageSize = file->GetSize();
     CELL_ASSERT(imageSize == 1024 * 1024 * 4);
 
-    Memory::OwnedBlock<uint8_t> imageData(imageSize);
+    // the file fills the whole block, no need to clear it first
+    Memory::OwnedBlock<uint8_t> imageData(imageSize, Memory::Uninitialized);
     IO::Result ioResult = file->Read(imageData);
     CELL_ASSERT(ioResult == IO::Result::Success);
 